@@ -0,0 +1,49 @@
+#!/usr/bin/env bash
+# 对比 switch 分派与 computed-goto 分派两种 VM::run 构建的运行时间
+# 用法: bench/run.sh [重复次数]
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+runs="${1:-3}"
+build_root="_bench_build"
+
+build() {
+    local name="$1"
+    shift
+    echo "构建 ${name} ..."
+    local log="${build_root}/${name}.log"
+    mkdir -p "$build_root"
+    if ! { cmake -S . -B "${build_root}/${name}" -DLOX_RELEASE=ON "$@" &&
+           cmake --build "${build_root}/${name}" -j"$(nproc)"; } > "$log" 2>&1; then
+        cat "$log"
+        exit 1
+    fi
+}
+
+# 多次运行取最短时间（毫秒）
+best_time() {
+    local binary="$1" script="$2" best=""
+    for _ in $(seq "$runs"); do
+        local start end elapsed
+        start=$(date +%s%N)
+        "$binary" "$script" > /dev/null
+        end=$(date +%s%N)
+        elapsed=$(( (end - start) / 1000000 ))
+        if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then
+            best="$elapsed"
+        fi
+    done
+    echo "$best"
+}
+
+build switch -DLOX_COMPUTED_GOTO=OFF
+build goto -DLOX_COMPUTED_GOTO=ON
+
+printf "%-16s %10s %10s %8s\n" "benchmark" "switch(ms)" "goto(ms)" "speedup"
+for script in bench/*.lox; do
+    name=$(basename "$script" .lox)
+    t_switch=$(best_time "${build_root}/switch/lox" "$script")
+    t_goto=$(best_time "${build_root}/goto/lox" "$script")
+    speedup=$(awk -v a="$t_switch" -v b="$t_goto" 'BEGIN { if (b == 0) b = 1; printf "%.2fx", a / b }')
+    printf "%-16s %10s %10s %8s\n" "$name" "$t_switch" "$t_goto" "$speedup"
+done
@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <vector>
 #include <ostream>
 #include "opcode.hpp"
@@ -9,12 +10,53 @@ std::ostream &operator<<(std::ostream &os, Opcode op);
 std::ostream &operator<<(std::ostream &os, std::vector<Value, Allocator<Value>> &values);
 
 class Compiler;
+struct Shape;
+struct ObjClosure;
+
+// one per OP_GET_PROPERTY / OP_SET_PROPERTY site, addressed by the instruction's 16-bit operand
+struct InlineCache
+{
+    uint32_t shape_id_ = 0;       // 0: empty
+    uint32_t slot_ = 0;
+    Shape *next_shape_ = nullptr; // OP_SET_PROPERTY that adds the field: shape after the transition
+};
+
+// polymorphic cache for one OP_INVOKE / OP_SUPER_INVOKE site
+// an entry is valid while its class keeps the same stamp, and then its closure is still in methods_
+struct InvokeCache
+{
+    static constexpr int SIZE = 4;
+    struct Entry
+    {
+        uint32_t shape_id_ = 0;    // receiver shape, so a field shadowing the method misses; 0 for super calls
+        uint32_t class_stamp_ = 0; // 0: empty
+        ObjClosure *method_ = nullptr;
+    };
+    std::array<Entry, SIZE> entries_;
+    uint8_t next_ = 0; // round-robin victim
+
+    ObjClosure *find(uint32_t shape_id, uint32_t class_stamp) const
+    {
+        for (auto &entry : entries_)
+            if (entry.class_stamp_ == class_stamp && entry.shape_id_ == shape_id)
+                return entry.method_;
+        return nullptr;
+    }
+    void insert(uint32_t shape_id, uint32_t class_stamp, ObjClosure *method)
+    {
+        entries_[next_] = {shape_id, class_stamp, method};
+        next_ = (next_ + 1) % SIZE;
+    }
+};
+
 struct Chunk
 {
-    std::vector<uint8_t> bytecode_;
+    std::vector<uint8_t, Allocator<uint8_t>> bytecode_;
 
     std::vector<Value, Allocator<Value>> constants_;
-    std::vector<int> lines_;
+    std::vector<int, Allocator<int>> lines_;
+    std::vector<InlineCache, Allocator<InlineCache>> caches_;
+    std::vector<InvokeCache, Allocator<InvokeCache>> invoke_caches_;
 
     friend std::ostream &operator<<(std::ostream &os, const Chunk &chunk);
 };
@@ -9,5 +9,7 @@ enum InterpretResult
 #define FRAMES_MAX 64
 #define STACK_MAX (FRAMES_MAX * UINT8_MAX)
 
+#ifndef LOX_RELEASE
 #define DEBUG_MODE
  #define STRESS_TEST 
+#endif
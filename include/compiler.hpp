@@ -55,6 +55,40 @@ struct Compiler
     int scope_depth_ = 0;
 };
 
+// how Complication emits expressions. Stack emits stack code as it parses; Register first parses an
+// expression of constants, variables, assignments and arithmetic into a RegisterExpr, then emits
+// three-address instructions that read and write locals in their slots (src/register.cpp). Expressions
+// with anything else in them, such as calls, properties or and/or, get stack code under both
+enum class Backend
+{
+    Stack,
+    Register
+};
+
+// an expression the register backend parsed before emitting any code for it
+struct RegisterExpr
+{
+    enum class Kind { Constant, Nil, True, False, Local, Upvalue, Global, Unary, Binary, Assign };
+
+    Kind kind_;
+    TokenType operator_ = TOKEN_EOF;      // Unary, Binary
+    Kind target_ = Kind::Local;           // Assign: stores to a Local, Upvalue or Global
+    int index_ = 0;                       // the constant, or the slot of the variable read or assigned
+    int line_ = 0;                        // of the code emitted for this node
+    std::unique_ptr<RegisterExpr> left_;  // Binary
+    std::unique_ptr<RegisterExpr> right_; // Binary, the operand of Unary, the value of Assign
+};
+
+// where the code for a RegisterExpr left its value: the slot of a local, a constant, or a temporary;
+// temporaries live on the stack above the locals, and the temporaries of an expression are the topmost
+struct Operand
+{
+    enum class Kind { Register, Constant, Temp };
+
+    Kind kind_;
+    uint8_t index_; // slot, or constant
+};
+
 struct Complication
 {
     Complication(VM &vm);
@@ -101,15 +135,18 @@ struct Complication
     void function(FunctionType type);
     void method();
     void name_variable(const Token &name, bool canAssign);
-    uint8_t parse_variable(const std::string_view &message);
+    uint16_t parse_variable(const std::string_view &message);
     uint8_t identifier_constant(const Token &token);
+    uint16_t global_slot(const Token &token);
     int emit_jump(Opcode instruction);
+    int emit_condition_jump(int conditionStart, bool &fused); // fused: nothing left on the stack to pop
+    int emit_compare_jump(Opcode compare, bool negated, uint8_t slot, uint8_t operand, bool constant);
     void patch_jump(int offset);
     void patch_offset(int start, int end);
     bool check(TokenType type);
     bool match(TokenType type);
     void declaration();
-    void define_global(uint8_t global);
+    void define_global(uint16_t global);
     void declare_local();
     void class_declaration();
     void fun_declaration();
@@ -136,10 +173,34 @@ struct Complication
     uint8_t add_constant(const Value &value);
     void emit_constant(const Value &value);
     void emit_bytes(uint8_t byte1, uint8_t byte2);
+    void emit_short(Opcode op, uint16_t operand);
+    void emit_cache(); // operand naming a fresh InlineCache of the current chunk
+    void emit_invoke_cache();
     void emit_return();
     void emit_byte(uint8_t byte);
     uint8_t make_constant(Value value);
 
+    // register backend (src/register.cpp). register_expression parses an expression into a tree, or
+    // returns nullptr with the parser left where it was when the expression needs stack code; the
+    // emitters then compile the tree as a statement's expression, its value discarded, pushed for
+    // print/return/var, or jumped on as a condition
+    std::unique_ptr<RegisterExpr> register_expression();
+    std::unique_ptr<RegisterExpr> parse_register(Precedence precedence, int &nodes);
+    std::unique_ptr<RegisterExpr> register_prefix(bool canAssign, int &nodes);
+    void emit_register_effect(const RegisterExpr &tree);
+    void emit_register_value(const RegisterExpr &tree, int top);
+    int emit_register_condition(const RegisterExpr &tree, int conditionStart, bool &fused);
+    Operand emit_register(const RegisterExpr &node);
+    Operand emit_register_into(const RegisterExpr &node, int slot); // slot -1: into a temporary
+    Operand emit_register_unary(const RegisterExpr &node, int slot);
+    Operand emit_register_binary(const RegisterExpr &node, int slot);
+    Operand emit_three_address(int index, Operand left, Operand right, int slot);
+    Operand emit_register_move(Operand value, int slot);
+    Operand emit_register_push(Operand value);
+
+    Backend backend_ = Backend::Stack;
+    int register_top_ = 0; // register backend: slots in use, the next temporary goes here
+
     std::unique_ptr<ClassCompiler> current_class_ = nullptr;
     std::unique_ptr<Compiler> current_;
     std::unique_ptr<Parser> parser_;
@@ -1,28 +1,32 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <deque>
 #include <memory>
-#include <set>
+#include <thread>
+#include <vector>
 #include "table.hpp"
 #include "obj.hpp"
+#include "slab.hpp"
 #include "common.hpp"
 
 struct ObjString;
+struct ObjArray;
+struct Shape;
 struct VM;
 
 struct GC;
 struct Obj;
+struct MarkWorker;
 
 struct AllocBase
 {
-	inline static GC *gc = nullptr;
-	static void init(GC *value) noexcept
-	{
-		if (gc == nullptr && value != nullptr)
-			gc = value;
-	}
+	inline static thread_local GC *gc = nullptr;	 // the collector of the VM running on this thread, set by its GC
+	inline static thread_local bool sweeper = false; // frees on the background sweeper are settled by GC::finish_background_sweep
 };
 
 template <typename T>
@@ -42,42 +46,196 @@ struct Allocator : AllocBase
 
 	T *allocate(std::size_t n);
 	void deallocate(T *p, std::size_t n);
+
+	// stateless: any instance frees what another allocated
+	template <typename U>
+	bool operator==(const Allocator<U> &) const { return true; }
+	template <typename U>
+	bool operator!=(const Allocator<U> &) const { return false; }
+};
+
+enum class GCPhase
+{
+	Idle,
+	Mark,  // incremental cycle: gray objects left to trace
+	Sweep, // incremental cycle: sweeping_ left to sweep
+	Background, // sweeper_ is sweeping sweeping_ while the mutator runs
+};
+
+struct ObjStats
+{
+	size_t count = 0;
+	size_t bytes = 0;
 };
 
 struct GC
 {
-	std::unique_ptr<Obj, ObjDeleter> objects_ = nullptr;
-	std::set<ObjString *, std::less<ObjString *>, Allocator<ObjString *>> strings_;
+	using Clock = std::chrono::steady_clock;
+
+	Obj *objects_ = nullptr; // newest first, owned
+	StringTable strings_;
 	std::deque<Obj *> gray_stack_;
 
 	size_t bytes_allocated_ = 0;
 	size_t next_gc_ = 1024 * 1024;
 
+	// generational mode: objects_ before first_old_ are young, everything from it on survived a collection
+	Obj *first_old_ = nullptr;
+	std::vector<Obj *> remembered_; // old objects that were given a young reference since the last collection
+	size_t nursery_bytes_ = 0;		// allocated since the last collection
+	size_t nursery_size_ = 256 * 1024;
+	bool minor_ = false; // the running collection treats old objects as live
+
+	// incremental mode (pause_us_ > 0): full collections run as slices of at most pause_us_ microseconds,
+	// one per step_bytes_ of allocation; minor collections wait until the cycle is over
+	GCPhase phase_ = GCPhase::Idle;
+	long pause_us_ = 0;
+	size_t step_bytes_ = 64 * 1024;
+	Obj *sweeping_ = nullptr;	   // objects_ as of the end of marking, owned
+	Obj *sweep_prev_ = nullptr;	   // last survivor kept in sweeping_
+	Obj *objects_tail_ = nullptr;  // oldest object allocated while sweeping
+	ObjArray *scanning_ = nullptr; // large array being traced a chunk at a time
+	size_t scan_pos_ = 0;
+	size_t cycle_start_bytes_ = 0;
+
+	// parallel mode (gc_threads_ > 0): stop-the-world full collections mark on gc_threads_ threads, the mutator
+	// included, and leave the sweep to a background thread; minor collections wait until it is done
+	int gc_threads_ = 0;
+	std::thread sweeper_;
+	std::atomic<bool> sweep_done_ = false;
+	size_t swept_bytes_ = 0; // freed by sweeper_, only read once it is joined
+
+	// the destructor leaves the objects to the operating system instead of freeing them one by one,
+	// for runs that end the process right after the VM
+	bool fast_exit_ = false;
+	// the DEBUG_MODE and STRESS_TEST traces; worker threads turn them off for their VMs, whose output would
+	// interleave with the main script's at the mercy of thread timing
+	inline static thread_local bool trace_ = true;
+
 	VM &vm_;
 
-	explicit GC(VM &vm) noexcept
-		: vm_(vm)
+	explicit GC(VM &vm) noexcept;
+	~GC();
+
+	void collect();
+	bool should_collect() const
+	{
+		if (phase_ == GCPhase::Background) // take the survivors back as soon as the sweeper is done
+			return sweep_done_.load(std::memory_order_acquire) || bytes_allocated_ > next_gc_;
+		if (phase_ != GCPhase::Idle)
+			return nursery_bytes_ > step_bytes_;
+#ifdef GENERATIONAL_GC
+		if (nursery_bytes_ > nursery_size_)
+			return true;
+#endif
+		return bytes_allocated_ > next_gc_;
+	}
+	// allocation only accounts its bytes; VM::run calls this between instructions, where every live
+	// object is reachable from the roots, so nothing has to be pushed just to survive a collection
+	void safepoint()
 	{
+#ifndef STRESS_TEST
+		if (should_collect())
+#endif
+			collect();
 	}
 
-	void collect();
+	// call after storing value into owner
+	// generational: an old owner is remembered so the next minor collection traces it again
+	// incremental: the value is shaded, so a black owner never points to a white object
+	void write_barrier(Obj *owner, Obj *value)
+	{
+		if (value == nullptr)
+			return;
+		shade(value);
+		if (!value->is_old_)
+			remember(owner);
+	}
+	// call when a coroutine stops running: its stack was written without barriers, so the next minor
+	// collection traces it again, and a cycle that already marked it rescans it before finishing
+	void switched_out(Obj *coroutine)
+	{
+		if (phase_ == GCPhase::Mark && coroutine->is_marked_)
+			gray_stack_.push_back(coroutine);
+		remember(coroutine);
+	}
+	void write_barrier(Obj *owner, const Value &value)
+	{
+		if (value.is_obj())
+			write_barrier(owner, value.as<Obj *>());
+	}
+	void remember(Obj *owner)
+	{
+#ifdef GENERATIONAL_GC
+		// while sweeping lazily, marked objects are survivors that will be promoted when reached
+		bool old = owner->is_old_ || (phase_ == GCPhase::Sweep && owner->is_marked_);
+		if (old && !owner->is_remembered_)
+		{
+			owner->is_remembered_ = true;
+			remembered_.push_back(owner);
+		}
+#else
+		(void)owner;
+#endif
+	}
+	void shade(Obj *ptr)
+	{
+		if (phase_ == GCPhase::Mark && !ptr->is_marked_)
+			mark_object(ptr);
+	}
+	// an interned string handed out again by content
+	void shade_interned(Obj *str)
+	{
+		shade(str);
+		// dead strings leave the intern table only as they are swept, so keep this one alive;
+		// strings hold no references, so a mark left over for the next cycle is harmless
+		if (phase_ == GCPhase::Sweep)
+			str->is_marked_ = true;
+	}
+	// elements of array moved without barriers (insert/erase), so a chunked trace of it starts over
+	void restart_scan(ObjArray *array)
+	{
+		if (array == scanning_)
+			scan_pos_ = 0;
+	}
+	void on_register(Obj *ptr) // objects allocated while marking start gray
+	{
+		if (phase_ == GCPhase::Mark)
+			mark_object(ptr);
+		else if (phase_ != GCPhase::Idle && objects_ == nullptr)
+			objects_tail_ = ptr;
+	}
 
 private:
 	void mark_roots();
 	void mark_array(const std::vector<Value, Allocator<Value>> &array);
 	// void mark_compiler_roots();
 	void mark_object(Obj *const ptr);
+	void mark_coroutine(Obj *const ptr);
 	void mark_table(const Table &table);
+	void mark_shape(const Shape &shape);
 	void mark_value(const Value &value);
 
-	void trace_references();
+	bool trace_references(Clock::time_point deadline = Clock::time_point::max()); // true once no gray object is left
 	void blacken_object(Obj *ptr);
 	void remove_white_string() noexcept;
 
 	void sweep();
 
+	void parallel_mark();
+	bool steal(MarkWorker *workers, int self);
+	void start_background_sweep();
+	void finish_background_sweep();
+
+	void step();
+	void finish_mark();
+	bool sweep_slice(Clock::time_point deadline); // true once sweeping_ is done
+	void finish_sweep();
+
 public:
-	ObjString *find_string(const std::string_view &str) const;
+	ObjString *find_string(const std::string_view &str, uint32_t hash) const;
+	// every object in the heap by ObjType, including garbage an incremental sweep has not reached yet
+	std::array<ObjStats, OBJ_TYPE_COUNT> census();
 
 };
 
@@ -85,24 +243,38 @@ template <typename T>
 T *Allocator<T>::allocate(std::size_t n)
 {
 	auto alloc_size = n * sizeof(T);
+#ifdef SLAB_ALLOC
+	static_assert(alignof(T) <= slab::GRANULE);
+	auto p = alloc_size <= slab::MAX_SIZE ? static_cast<T *>(slab::allocate(alloc_size)) : worker_traits::allocate(worker, n);
+#else
 	auto p = worker_traits::allocate(worker, n);
+#endif
 
 #ifdef STRESS_TEST
-	std::cout << "allocate: " << alloc_size << std::endl;
+	if (gc->trace_)
+		std::cout << "allocate: " << alloc_size << std::endl;
 #endif
 	gc->bytes_allocated_ += alloc_size;
-#ifndef STRESS_TEST
-	if (gc->bytes_allocated_ > gc->next_gc_)
-#endif
-		gc->collect();
-	
-
+	gc->nursery_bytes_ += alloc_size;
 	return p;
 }
 
 template <typename T>
 void Allocator<T>::deallocate(T *p, std::size_t n)
 {
-	worker_traits::deallocate(worker, p, n);
-	gc->bytes_allocated_ -= sizeof(T) * n;
+#ifdef SLAB_ALLOC
+	if (sizeof(T) * n <= slab::MAX_SIZE)
+	{
+		if (sweeper)
+			slab::free_remote(p);
+		else
+			slab::deallocate(p);
+	}
+	else
+#endif
+		worker_traits::deallocate(worker, p, n);
+	if (sweeper)
+		gc->swept_bytes_ += sizeof(T) * n;
+	else
+		gc->bytes_allocated_ -= sizeof(T) * n;
 }
@@ -1,6 +1,12 @@
 #pragma once
 #include "value.hpp"
+#include "memory.hpp"
+#include "object.hpp"
+#include "objstring.hpp"
+#include "vm.hpp"
+#include "workers.hpp"
 #include <chrono>
+#include <climits>
 
 class Native {
     public:
@@ -9,7 +15,9 @@ class Native {
 	    return static_cast<int>(std::chrono::duration<double>(tp).count());
     }
     static Value push(int argCount, Value* args) {
-        args[0].as_obj<ObjArray>()->values_.push_back(args[1]);
+        auto array = args[0].as_obj<ObjArray>();
+        array->values_.push_back(args[1]);
+        AllocBase::gc->write_barrier(array, args[1]);
         return Value();
     }
     static Value pop(int argCount, Value* args) {
@@ -24,13 +32,68 @@ class Native {
         auto& array = value->values_;
         auto ret = array.at(index);
         array.erase(index + array.begin());
+        AllocBase::gc->restart_scan(value);
         return ret;
     }
     static Value insert(int argCount, Value* args) {
-        auto& array = args[0].as_obj<ObjArray>()->values_;
+        auto obj = args[0].as_obj<ObjArray>();
+        auto& array = obj->values_;
         auto index = args[1].as<int>();
         auto value = args[2];
         array.insert(index + array.begin(), value);
+        AllocBase::gc->write_barrier(obj, value);
+        AllocBase::gc->restart_scan(obj);
         return Value();
     }
+    // spawn(co) or spawn(co, priority): hand a suspended coroutine to the scheduler, which runs it
+    // whenever the running spawned coroutine (main included) yields or finishes
+    static Value spawn(int argCount, Value* args) {
+        if (!args[0].is_obj_type<ObjCoroutine>())
+            throw std::runtime_error("Only a coroutine can be spawned.");
+        if (argCount > 1 && !args[1].is_number())
+            throw std::runtime_error("Priority must be a number.");
+        auto& vm = AllocBase::gc->vm_;
+        auto priority = argCount > 1 ? args[1].as<int>() : 0;
+        vm.scheduler_.spawnCoroutine(args[0].as_obj<ObjCoroutine>(), priority);
+        return args[0];
+    }
+    // submit(co): run a coroutine that has not started yet on the worker pool, in a VM of its own (workers.hpp)
+    static Value submit(int argCount, Value* args) {
+        if (!args[0].is_obj_type<ObjCoroutine>())
+            throw std::runtime_error("Only a coroutine can be submitted.");
+        submit_coroutine(AllocBase::gc->vm_, args[0].as_obj<ObjCoroutine>());
+        return args[0];
+    }
+    // join(co): wait for a submitted coroutine and return what its function returned, nil if it failed
+    static Value join(int argCount, Value* args) {
+        if (!args[0].is_obj_type<ObjCoroutine>())
+            throw std::runtime_error("Only a submitted coroutine can be joined.");
+        return join_coroutine(AllocBase::gc->vm_, args[0].as_obj<ObjCoroutine>());
+    }
+    // { "bytes": allocated, "next": next full collection, <type name>: { "count": objects, "bytes": footprint } }
+    static Value gcStats(int argCount, Value* args) {
+        auto& gc = *AllocBase::gc;
+        auto& vm = gc.vm_;
+        auto census = gc.census();
+        auto number = [](size_t n) { return Value(static_cast<int>(std::min<size_t>(n, INT_MAX))); };
+        auto set = [&](ObjJson* json, std::string_view key, Value value) {
+            Value name = create_obj_string(key, vm);
+            json->kv_[name] = value;
+            gc.write_barrier(json, name);
+            gc.write_barrier(json, value);
+        };
+
+        auto stats = create_obj<ObjJson>(gc);
+        set(stats, "bytes", number(gc.bytes_allocated_));
+        set(stats, "next", number(gc.next_gc_));
+        for (size_t type = 0; type < OBJ_TYPE_COUNT; type++) {
+            if (census[type].count == 0)
+                continue;
+            auto entry = create_obj<ObjJson>(gc);
+            set(entry, "count", number(census[type].count));
+            set(entry, "bytes", number(census[type].bytes));
+            set(stats, nameof(static_cast<ObjType>(type)), entry);
+        }
+        return stats;
+    }
 };
\ No newline at end of file
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <functional>
-#include <memory>
+#include <cstddef>
+#include <cstdint>
 
-enum class ObjType
+enum class ObjType : uint8_t
 {
 	BoundMethod,
 	Class,
@@ -17,14 +17,16 @@ enum class ObjType
 	Json,
 	Coroutine
 };
+constexpr auto OBJ_TYPE_COUNT = static_cast<size_t>(ObjType::Coroutine) + 1;
 
-struct Obj;
-using ObjDeleter = std::function<void(Obj*)>;
+// 16-byte header; objects are freed through free_object, which dispatches on type_
 struct Obj
 {
 	ObjType type_;
 	bool is_marked_ = false;
-	std::unique_ptr<Obj, ObjDeleter> next_ = nullptr;
+	bool is_old_ = false;		 // survived a collection (GENERATIONAL_GC)
+	bool is_remembered_ = false; // already in GC::remembered_
+	Obj *next_ = nullptr;		 // next in the GC list that owns this object
 
 	bool is_type(ObjType type) const
 	{
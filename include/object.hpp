@@ -2,29 +2,35 @@
 
 #include <string_view>
 #include "table.hpp"
+#include "shape.hpp"
 #include "obj.hpp"
 #include "chunk.hpp"
 #include "common.hpp"
+#include <algorithm>
 #include <functional>
+#include <memory>
 #include <unordered_map>
 
 struct ObjString;
 struct ObjClosure;
 struct GC;
 struct Obj;
+struct WorkerTask;
 
 struct CallFrame {
     ObjClosure* closure_ = nullptr;
-    uint8_t ip_ = 0;
-    int slot_ = 0;
+    const uint8_t* ip_ = nullptr;
+    const Value* constants_ = nullptr; // closure_->function_->chunk_.constants_ cached for the dispatch loop
+    InlineCache* caches_ = nullptr;    // likewise chunk_.caches_
+    InvokeCache* invoke_caches_ = nullptr;
+    Value* slots_ = nullptr;           // first stack slot of this frame
 
-    uint8_t read_byte();
-	Value read_constant();
-	uint16_t read_short();
-	ObjString* read_string();
+    void init(ObjClosure* closure, Value* slots);
 };
 
-void register_obj(std::unique_ptr<Obj, ObjDeleter> &&obj, GC &gc);
+void register_obj(Obj *obj, GC &gc);
+void free_object(Obj *obj);
+size_t object_footprint(const Obj *obj); // the object and the buffers it owns, in bytes
 
 template <typename T>
 auto delete_obj(Allocator<T> &alloc, T *ptr)
@@ -95,21 +101,29 @@ struct ObjClass : public Obj
 {
 	ObjString *const name_;
 	Table methods_;
+	ShapePtr root_shape_; // owns every shape its instances can reach
+	uint32_t stamp_;					// renewed whenever methods_ changes, invalidating InvokeCache entries
 
 	ObjClass(ObjString *name)
-		: Obj(ObjType::Class), name_(name)
+		: Obj(ObjType::Class), name_(name), root_shape_(make_shape()), stamp_(next_stamp_++)
 	{
 	}
+
+	void touch() { stamp_ = next_stamp_++; }
+
+private:
+	inline static thread_local uint32_t next_stamp_ = 1; // per thread, like the VMs whose caches compare it
 };
 std::ostream &operator<<(std::ostream &os, const ObjClass &c);
 
 struct ObjInstance : public Obj
 {
 	ObjClass *const objClass_;
-	Table fields_;
+	Shape *shape_;
+	std::vector<Value, Allocator<Value>> fields_; // indexed by shape_ slots
 
 	ObjInstance(ObjClass *objClass)
-		: Obj(ObjType::Instance), objClass_(objClass)
+		: Obj(ObjType::Instance), objClass_(objClass), shape_(objClass->root_shape_.get())
 	{
 	}
 };
@@ -149,41 +163,53 @@ std::ostream &operator<<(std::ostream &os, const ObjBoundMethod &bm);
 
 enum class CoroutineStatus { RUNNING, SUSPENDED, FINISHED };
 
+// stack_ and frames_ start small and double when full (frames_ up to FRAMES_MAX), so a coroutine
+// costs about as much as the code it runs; growing moves stack_, and grow_stack rebases every
+// pointer into it: the frames' slots_ and the locations of this coroutine's open upvalues
 struct ObjCoroutine : public Obj
 {
-	const int default_init = 20;
+	static constexpr size_t INITIAL_STACK = 32;
+	static constexpr size_t INITIAL_FRAMES = 4;
+
 	ObjClosure* closure_;
-	std::vector<Value> stack_;
-	std::vector<CallFrame> frames_;
+	std::vector<Value, Allocator<Value>> stack_;
+	std::vector<CallFrame, Allocator<CallFrame>> frames_;
+	ObjUpvalue *open_upvalues_ = nullptr; // upvalues still pointing into stack_, highest slot first
 	
 	int frame_count_;
 	int top_;
 	CoroutineStatus status_;
-	std::vector<Value> arguments_;
+	std::vector<Value, Allocator<Value>> arguments_;
 	bool is_main_ = false;
+
+	// Scheduler state
+	ObjCoroutine *resumer_ = nullptr; // suspended in resume until this coroutine yields or finishes
+	ObjCoroutine *prev_ready_ = nullptr;
+	ObjCoroutine *next_ready_ = nullptr;
+	bool ready_ = false;   // linked into the ready queue
+	bool spawned_ = false; // goes back to the ready queue when it yields
+	uint8_t priority_ = 0;
+	std::shared_ptr<WorkerTask> task_; // set by submit(), after which the coroutine runs on a worker thread only
 	ObjCoroutine(ObjClosure *closure, const std::vector<Value>& arguments = {});
-	ObjCoroutine() : stack_(default_init), top_(0) {}
+
+	void grow_stack();
+	void grow_frames() { frames_.resize(std::min<size_t>(frames_.size() * 2, FRAMES_MAX)); }
 };
 
 std::ostream &operator<<(std::ostream &os, const ObjCoroutine& co);
 
 
+// not yet owned by the GC: hand the result to register_obj, or to free_object
 template <typename T, typename... Args>
-auto alloc_unique_obj(Args &&...args)
-	-> typename std::enable_if_t<std::is_base_of_v<Obj, T>, std::unique_ptr<Obj, ObjDeleter>>
+auto alloc_obj(Args &&...args)
+	-> typename std::enable_if_t<std::is_base_of_v<Obj, T>, T *>
 {
-	static Allocator<T> a;
+	Allocator<T> a;
 
 	using AllocTraits = std::allocator_traits<Allocator<T>>;
 	auto p = AllocTraits::allocate(a, 1);
 	AllocTraits::construct(a, p, std::forward<Args>(args)...);
-
-	auto deleter = [](Obj *ptr)
-	{
-		delete_obj(a, static_cast<T *>(ptr));
-	};
-
-	return {p, deleter};
+	return p;
 }
 
 template <typename T, typename... Args>
@@ -191,10 +217,9 @@ auto create_obj(GC &gc, Args &&...args)
 	-> typename std::enable_if_t<std::is_base_of_v<Obj, T>, T *>
 {
 	static_assert(std::is_constructible_v<T, Args...>);
-	auto p = alloc_unique_obj<T>(std::forward<Args>(args)...);
-	auto res = p.get();
-	register_obj(std::move(p), gc);
-	return static_cast<T *>(res);
+	auto p = alloc_obj<T>(std::forward<Args>(args)...);
+	register_obj(p, gc);
+	return p;
 }
 
 template <typename T>
@@ -225,12 +250,9 @@ constexpr auto objtype_of()
 		return ObjType::Coroutine;
 }
 
-template <typename T>
-constexpr auto nameof()
-	-> typename std::enable_if_t<std::is_base_of_v<Obj, T> && !std::is_same_v<Obj, T>, std::string_view>
+constexpr std::string_view nameof(ObjType type)
 {
-
-	switch (objtype_of<T>())
+	switch (type)
 	{
 	case ObjType::BoundMethod:
 		return "bound method";
@@ -259,4 +281,11 @@ constexpr auto nameof()
 	}
 }
 
+template <typename T>
+constexpr auto nameof()
+	-> typename std::enable_if_t<std::is_base_of_v<Obj, T> && !std::is_same_v<Obj, T>, std::string_view>
+{
+	return nameof(objtype_of<T>());
+}
+
 std::ostream &operator<<(std::ostream &os, const Obj &obj);
\ No newline at end of file
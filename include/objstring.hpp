@@ -18,6 +18,7 @@ struct ObjString : public Obj
         return text() != str.text();
     }
     clox_string content_;
+    uint32_t hash_ = 0;
 
     explicit ObjString() : Obj(ObjType::String) {}
     std::string_view text() const { return content_; }
@@ -28,5 +29,7 @@ std::ostream &operator<<(std::ostream &os, const ObjString &s);
 clox_string operator+(const ObjString &lhs, const ObjString &rhs);
 bool operator==(const ObjString &lhs, const ObjString &rhs);
 
+uint32_t hash_string(std::string_view str);
+
 template <typename T>
 ObjString *create_obj_string(T &&str, VM &vm);
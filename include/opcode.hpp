@@ -1,4 +1,6 @@
 #pragma once
+#include "superinstructions.hpp"
+
 #define OPCODE_NAMES \
     X(OP_RETURN)     \
     X(OP_CONSTANT)   \
@@ -14,8 +16,12 @@
     X(OP_EQUAL)        \
     X(OP_GREATER)        \
     X(OP_LESS)        \
+    X(OP_NOT_EQUAL) \
+    X(OP_LESS_EQUAL) \
+    X(OP_GREATER_EQUAL) \
     X(OP_PRINT)        \
     X(OP_POP)        \
+    X(OP_POPN) \
     X(OP_DEFINE_GLOBAL) \
     X(OP_GET_GLOBAL) \
     X(OP_SET_GLOBAL) \
@@ -24,6 +30,18 @@
     X(OP_JUMP_IF_FALSE) \
     X(OP_JUMP) \
     X(OP_LOOP) \
+    X(OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL) \
+    X(OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL) \
+    X(OP_JUMP_IF_NOT_GREATER_LOCAL_LOCAL) \
+    X(OP_JUMP_IF_EQUAL_LOCAL_LOCAL) \
+    X(OP_JUMP_IF_LESS_LOCAL_LOCAL) \
+    X(OP_JUMP_IF_GREATER_LOCAL_LOCAL) \
+    X(OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST) \
+    X(OP_JUMP_IF_NOT_LESS_LOCAL_CONST) \
+    X(OP_JUMP_IF_NOT_GREATER_LOCAL_CONST) \
+    X(OP_JUMP_IF_EQUAL_LOCAL_CONST) \
+    X(OP_JUMP_IF_LESS_LOCAL_CONST) \
+    X(OP_JUMP_IF_GREATER_LOCAL_CONST) \
     X(OP_CALL) \
     X(OP_CLOSURE) \
     X(OP_GET_UPVALUE) \
@@ -47,6 +65,29 @@
     X(OP_CREATE_COROUTINE) \
     X(OP_YIELD_COROUTINE) \
     X(OP_RESUME_COROUTINE) \
+    X(OP_ADD_REG_REG) \
+    X(OP_SUB_REG_REG) \
+    X(OP_MUL_REG_REG) \
+    X(OP_DIV_REG_REG) \
+    X(OP_EQUAL_REG_REG) \
+    X(OP_LESS_REG_REG) \
+    X(OP_GREATER_REG_REG) \
+    X(OP_ADD_REG_CONST) \
+    X(OP_SUB_REG_CONST) \
+    X(OP_MUL_REG_CONST) \
+    X(OP_DIV_REG_CONST) \
+    X(OP_EQUAL_REG_CONST) \
+    X(OP_LESS_REG_CONST) \
+    X(OP_GREATER_REG_CONST) \
+    X(OP_NEGATE_REG) \
+    X(OP_NOT_REG) \
+    X(OP_MOVE_REG) \
+    X(OP_LOAD_CONST) \
+    X(OP_ADD_INT) \
+    X(OP_ADD_STR) \
+    X(OP_LESS_INT) \
+    X(OP_GET_ELEMENT_ARRAY) \
+    SUPERINSTRUCTION_NAMES
 
 enum Opcode
 {
@@ -54,3 +95,22 @@ enum Opcode
     OPCODE_NAMES
 #undef X
 };
+
+// OP_JUMP_IF_*_LOCAL_*: compare a local with a local or constant and jump when the condition of an
+// if/while/for is false, without pushing it; Complication::emit_condition_jump indexes them in the
+// order above, so keep them together
+constexpr Opcode FIRST_COMPARE_JUMP = OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL;
+constexpr Opcode LAST_COMPARE_JUMP = OP_JUMP_IF_GREATER_LOCAL_CONST;
+
+// OP_*_REG_REG A B C and OP_*_REG_CONST A B K: emitted by the register backend (Backend::Register), they
+// write slot B op slot C (or constant K) to slot A of the frame; the compiler indexes them in the order
+// above by operator, so keep them together. OP_NEGATE_REG and OP_NOT_REG A B, OP_MOVE_REG A B and
+// OP_LOAD_CONST A K write slot A as well. A slot A one past the top of the stack is a new temporary,
+// and the result is pushed
+constexpr Opcode FIRST_REG_REG = OP_ADD_REG_REG;
+constexpr Opcode FIRST_REG_CONST = OP_ADD_REG_CONST;
+constexpr Opcode LAST_REG_CONST = OP_GREATER_REG_CONST;
+
+// OP_ADD_INT, OP_ADD_STR, OP_LESS_INT, OP_GET_ELEMENT_ARRAY: never emitted by the compiler; VM::run
+// rewrites an OP_ADD/OP_LESS/OP_GET_ELEMENT to one of them in place once it has seen the operand
+// types (QUICKEN_BYTECODE), and back to the generic opcode when an operand stops matching
@@ -0,0 +1,17 @@
+#pragma once
+#include "chunk.hpp"
+
+// peephole pass over a finished chunk (OPTIMIZE_BYTECODE), run by Complication::end_compiler
+// - folds arithmetic and comparisons of integer constants, ! of literals, and conditional jumps on literals
+// - fuses OP_EQUAL/OP_LESS/OP_GREATER followed by OP_NOT into one opcode
+// - threads jumps that land on an unconditional jump, and drops jumps to the next instruction
+// - drops a constant or local pushed only to be popped, and merges runs of OP_POP into OP_POPN
+// - finally overwrites the first opcode of each run listed in SUPERINSTRUCTIONS; the rest of the run's
+//   bytes stay, so a jump into the run still finds its instructions
+// patterns never span a jump target; jump operands and lines_ are rebuilt for the new layout,
+// and a chunk whose jumps do not land on instruction boundaries is left alone
+void optimize_chunk(Chunk &chunk);
+
+// bytes taken by the instruction at offset, operands included; a superinstruction counts as its first component
+int instruction_length(const Chunk &chunk, int offset);
+Opcode first_component(Opcode op);
@@ -0,0 +1,43 @@
+#pragma once
+#include "chunk.hpp"
+#include "optimizer.hpp"
+#include <cstdint>
+#include <unordered_map>
+
+// counts runs of opcodes that execute back to back without a jump between them (PROFILE_OPCODES);
+// tools/superinst.cpp turns the most frequent runs into superinstructions
+struct OpcodeProfile
+{
+	static constexpr int MAX_LENGTH = 6;
+
+	// key: run length in the top byte, then one opcode per byte, first opcode highest
+	std::unordered_map<uint64_t, uint64_t> runs_;
+
+	void record(const Chunk &chunk, const uint8_t *ip)
+	{
+		if (&chunk != chunk_ || ip != next_)
+			length_ = 0; // jumped, called or returned: nothing falls through into this instruction
+		if (length_ == MAX_LENGTH)
+		{
+			for (int i = 1; i < MAX_LENGTH; i++)
+				window_[i - 1] = window_[i];
+			length_--;
+		}
+		window_[length_++] = *ip;
+		for (int n = 2; n <= length_; n++)
+		{
+			uint64_t key = n;
+			for (int i = length_ - n; i < length_; i++)
+				key = (key << 8) | window_[i];
+			runs_[key]++;
+		}
+		chunk_ = &chunk;
+		next_ = ip + instruction_length(chunk, static_cast<int>(ip - chunk.bytecode_.data()));
+	}
+
+private:
+	const Chunk *chunk_ = nullptr;
+	const uint8_t *next_ = nullptr; // where the last instruction falls through to
+	uint8_t window_[MAX_LENGTH] = {};
+	int length_ = 0;
+};
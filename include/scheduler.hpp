@@ -2,17 +2,58 @@
 #include "object.hpp"
 #include "memory.hpp"
 #include "common.hpp"
-#include <deque>
+#include <cstdint>
 class VM;
+
+// Fifo: spawned coroutines take turns in the order they became ready
+// Priority: the highest priority ready coroutine runs first, equal priorities take turns
+enum class SchedulePolicy { Fifo, Priority };
+
+constexpr int PRIORITY_LEVELS = 8; // spawn priorities are clamped to [0, PRIORITY_LEVELS)
+
+// A coroutine runs because it was resumed, and then goes back to whoever resumed it when it yields or
+// finishes, or because it was spawned, and then goes back to the ready queue when it yields. The main
+// coroutine is scheduled like a spawned one, so spawned coroutines run whenever it yields or returns;
+// the program ends once main and everything left in the ready queue have finished.
 struct Scheduler {
+    // intrusive FIFO through ObjCoroutine::prev_ready_/next_ready_
+    struct ReadyList {
+        ObjCoroutine* head = nullptr;
+        ObjCoroutine* tail = nullptr;
+    };
+
     VM& vm;
-    Scheduler(VM& vm) : vm(vm) {}
-    std::deque<ObjCoroutine*> coroutines_;  // Queue of coroutines
+    const SchedulePolicy policy_;
+    ReadyList ready_[PRIORITY_LEVELS]; // Fifo keeps everything in ready_[0]
+    uint32_t ready_mask_ = 0;          // bit i set while ready_[i] is not empty
     ObjCoroutine* current_coroutine_ = nullptr;  // The coroutine currently running
     ObjCoroutine* main_coroutine = nullptr;  // The main coroutine
 
-    void addObjCoroutine(ObjCoroutine* coroutine);
-    InterpretResult runNextObjCoroutine();
+    Scheduler(VM& vm, SchedulePolicy policy) : vm(vm), policy_(policy) {}
+
+    // switching coroutines only updates this bookkeeping and VM::current_coroutine_;
+    // VM::run reloads the frame of whichever coroutine is current and carries on in the same loop
+    void spawnCoroutine(ObjCoroutine* coroutine, int priority); // ignored unless suspended and not yet ready
+    void resumeCoroutine(ObjCoroutine* coroutine);              // ignored unless suspended, and not in resume itself
     void yieldCurrentObjCoroutine();
-    InterpretResult resumeCoroutine(ObjCoroutine* coroutine);
+    bool finishCurrentObjCoroutine(); // false once nothing is left to run
+
+    // runs main until every coroutine it left ready has finished too; a runtime error ends only the
+    // coroutine that raised it
+    InterpretResult start(ObjCoroutine* main);
+
+    template <typename Fn>
+    void for_each_ready(Fn&& fn) const
+    {
+        for (auto& list : ready_)
+            for (auto co = list.head; co != nullptr; co = co->next_ready_)
+                fn(co);
+    }
+
+private:
+    void enqueue(ObjCoroutine* coroutine);
+    void unlink(ObjCoroutine* coroutine);
+    ObjCoroutine* pop_ready();
+    void switch_to(ObjCoroutine* coroutine);
+    ObjCoroutine* take_resumer(ObjCoroutine* coroutine); // the coroutine that resumed it, if still waiting on it
 };
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "table.hpp"
+#include "memory.hpp"
+
+struct ObjString;
+struct Shape;
+
+struct ShapeDeleter
+{
+	void operator()(Shape *shape) const;
+};
+using ShapePtr = std::unique_ptr<Shape, ShapeDeleter>; // shapes live in Allocator memory, like the objects using them
+
+ShapePtr make_shape(Shape *parent = nullptr, ObjString *name = nullptr);
+
+// hidden class: instances of one ObjClass that gained the same fields in the
+// same order share a Shape, and keep their field values in a dense slot vector
+struct Shape
+{
+	const uint32_t id_; // never reused, so an inline cache can't mistake a new shape for a freed one
+	Shape *const parent_;
+	ObjString *const name_; // field added on the way from parent_, nullptr for the root
+	Table slots_;			// field name -> slot index
+	std::vector<ShapePtr, Allocator<ShapePtr>> transitions_;
+
+	Shape(Shape *parent = nullptr, ObjString *name = nullptr);
+	Shape(const Shape &) = delete;
+	Shape &operator=(const Shape &) = delete;
+
+	int find(ObjString *name) const; // slot index, -1 if the field is absent
+	Shape *transition(ObjString *name);
+	size_t field_count() const { return slots_.size(); }
+	size_t footprint() const; // this shape and everything it transitions to, in bytes
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// size-class slab allocator behind Allocator<T> (SLAB_ALLOC)
+// requests up to MAX_SIZE bytes are rounded up to a multiple of GRANULE and served from PAGE_SIZE pages
+// holding one size class each; every page keeps its own free list and live count, so freeing is a push
+// and a page whose blocks are all free again goes back to the system in release_empty_pages
+// every thread that runs a VM allocates from size classes of its own; the background sweeper frees through free_remote
+namespace slab
+{
+	constexpr size_t PAGE_SIZE = 64 * 1024; // pages are aligned to their size, so a block finds its page by masking
+	constexpr size_t GRANULE = 16;
+	constexpr size_t MAX_SIZE = 512;
+	constexpr size_t CLASS_COUNT = MAX_SIZE / GRANULE;
+
+	struct Block
+	{
+		Block *next;
+	};
+
+	struct Page
+	{
+		Page *next_page = nullptr;	  // every page of the size class
+		Page *next_partial = nullptr; // while on SizeClass::partial
+		Block *free = nullptr;
+		char *bump = nullptr; // blocks from bump to end were never handed out
+		char *end = nullptr;
+		uint32_t used = 0; // blocks handed out and not freed by the interpreter thread
+		uint32_t size_class = 0;
+		bool queued = false; // current page of its class, or on the partial list
+
+		// written only by the background sweeper, merged into free by release_empty_pages once it is joined
+		Block *remote_free = nullptr;
+		Block *remote_tail = nullptr;
+		uint32_t remote_count = 0;
+	};
+
+	struct SizeClass
+	{
+		Page *current; // allocated from until it runs out
+		Page *pages;
+		Page *partial; // pages other than current that have free blocks
+	};
+
+	inline thread_local SizeClass classes[CLASS_COUNT]; // zero-initialized and never destroyed, so late frees at exit still work
+
+	void *refill(size_t index);
+	void free_remote(void *p);
+	void release_empty_pages(); // after a full sweep
+	void release_thread_pages(); // when the thread is done with its VMs: empty current pages go as well
+
+	inline size_t class_of(size_t size) { return size == 0 ? 0 : (size - 1) / GRANULE; }
+	inline Page *page_of(void *p) { return reinterpret_cast<Page *>(reinterpret_cast<uintptr_t>(p) & ~(PAGE_SIZE - 1)); }
+
+	inline void *allocate(size_t size)
+	{
+		auto index = class_of(size);
+		if (auto page = classes[index].current)
+		{
+			if (auto block = page->free)
+			{
+				page->free = block->next;
+				page->used++;
+				return block;
+			}
+			if (page->bump != page->end)
+			{
+				auto p = page->bump;
+				page->bump += (index + 1) * GRANULE;
+				page->used++;
+				return p;
+			}
+		}
+		return refill(index);
+	}
+
+	inline void deallocate(void *p)
+	{
+		auto block = static_cast<Block *>(p);
+		auto page = page_of(p);
+		block->next = page->free;
+		page->free = block;
+		page->used--;
+		if (!page->queued)
+		{
+			auto &size_class = classes[page->size_class];
+			page->queued = true;
+			page->next_partial = size_class.partial;
+			size_class.partial = page;
+		}
+	}
+}
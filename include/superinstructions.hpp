@@ -0,0 +1,26 @@
+// generated by tools/superinst.cpp (cmake --build <dir> --target superinstructions), do not edit
+#pragma once
+
+#define SUPERINSTRUCTION_NAMES \
+    X(OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP) \
+    X(OP_SUPER_CONSTANT_MUL_SUB_CONSTANT_EQUAL_JUMP_IF_FALSE) \
+    X(OP_SUPER_GET_LOCAL_CONSTANT) \
+    X(OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT) \
+    X(OP_SUPER_GET_LOCAL_CONSTANT_SUB) \
+    X(OP_SUPER_GET_LOCAL_ADD) \
+    X(OP_SUPER_POP_GET_LOCAL) \
+    X(OP_SUPER_CONSTANT_GET_LOCAL_ADD_GET_LOCAL_GET_LOCAL_CONSTANT) \
+    X(OP_SUPER_POP_POP_LOOP) \
+
+// S(superinstruction, components...)
+#define SUPERINSTRUCTIONS \
+    S(OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP, OP_GET_LOCAL, OP_CONSTANT, OP_ADD, OP_SET_LOCAL, OP_POP, OP_LOOP) \
+    S(OP_SUPER_CONSTANT_MUL_SUB_CONSTANT_EQUAL_JUMP_IF_FALSE, OP_CONSTANT, OP_MUL, OP_SUB, OP_CONSTANT, OP_EQUAL, OP_JUMP_IF_FALSE) \
+    S(OP_SUPER_GET_LOCAL_CONSTANT, OP_GET_LOCAL, OP_CONSTANT) \
+    S(OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT, OP_GET_LOCAL, OP_GET_LOCAL, OP_CONSTANT) \
+    S(OP_SUPER_GET_LOCAL_CONSTANT_SUB, OP_GET_LOCAL, OP_CONSTANT, OP_SUB) \
+    S(OP_SUPER_GET_LOCAL_ADD, OP_GET_LOCAL, OP_ADD) \
+    S(OP_SUPER_POP_GET_LOCAL, OP_POP, OP_GET_LOCAL) \
+    S(OP_SUPER_CONSTANT_GET_LOCAL_ADD_GET_LOCAL_GET_LOCAL_CONSTANT, OP_CONSTANT, OP_GET_LOCAL, OP_ADD, OP_GET_LOCAL, OP_GET_LOCAL, OP_CONSTANT) \
+    S(OP_SUPER_POP_POP_LOOP, OP_POP, OP_POP, OP_LOOP) \
+
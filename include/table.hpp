@@ -1,5 +1,6 @@
 #pragma once
-#include <map>
+#include <cstddef>
+#include <string_view>
 #include "value.hpp"
 
 struct ObjString;
@@ -7,4 +8,94 @@ struct ObjString;
 template<typename T>
 struct Allocator;
 
-using Table = std::map<ObjString*, Value, std::less<ObjString*>, Allocator<std::pair<ObjString* const, Value>>>;
\ No newline at end of file
+// open-addressing map from interned strings to values, used for globals, fields and methods
+// keys compare by address; a removed entry leaves a tombstone (null key, true value)
+struct Table
+{
+	struct Entry
+	{
+		ObjString *key = nullptr;
+		Value value;
+	};
+
+	struct Iterator
+	{
+		Entry *entry;
+		Entry *end;
+
+		Entry &operator*() const { return *entry; }
+		Entry *operator->() const { return entry; }
+		Iterator &operator++()
+		{
+			++entry;
+			skip_empty();
+			return *this;
+		}
+		bool operator!=(const Iterator &other) const { return entry != other.entry; }
+
+		void skip_empty()
+		{
+			while (entry != end && entry->key == nullptr)
+				++entry;
+		}
+	};
+
+	Table() = default;
+	Table(const Table &) = delete;
+	Table &operator=(const Table &) = delete;
+	~Table();
+
+	// pointer into the table, valid until the next set()
+	Value *find(ObjString *key) const;
+	bool get(ObjString *key, Value &value) const;
+	bool set(ObjString *key, const Value &value); // true when the key is new
+	bool remove(ObjString *key);
+	void add_all(const Table &from);
+
+	size_t size() const { return count_ - tombstones_; }
+	size_t capacity() const { return capacity_; }
+
+	Iterator begin() const
+	{
+		Iterator it{entries_, entries_ + capacity_};
+		it.skip_empty();
+		return it;
+	}
+	Iterator end() const { return {entries_ + capacity_, entries_ + capacity_}; }
+
+private:
+	Entry *find_entry(ObjString *key) const;
+	void adjust_capacity(size_t capacity);
+
+	Entry *entries_ = nullptr;
+	size_t capacity_ = 0; // always zero or a power of two
+	size_t count_ = 0;	  // live entries plus tombstones
+	size_t tombstones_ = 0;
+};
+
+// open-addressing set of interned strings keyed by ObjString::hash_
+// entries are weak: GC::remove_white_string purges the unmarked ones
+struct StringTable
+{
+	StringTable() = default;
+	StringTable(const StringTable &) = delete;
+	StringTable &operator=(const StringTable &) = delete;
+	~StringTable();
+
+	ObjString *find(std::string_view str, uint32_t hash) const;
+	void insert(ObjString *str);
+	void remove(ObjString *str) noexcept;
+	void remove_white() noexcept;
+
+	size_t size() const { return count_ - tombstones_; }
+
+private:
+	void adjust_capacity(size_t capacity);
+
+	inline static ObjString *const TOMBSTONE = reinterpret_cast<ObjString *>(alignof(ObjString *));
+
+	ObjString **entries_ = nullptr;
+	size_t capacity_ = 0; // always zero or a power of two
+	size_t count_ = 0;	  // live entries plus tombstones
+	size_t tombstones_ = 0;
+};
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <iomanip>
 #include "chunk.hpp"
+#include "optimizer.hpp"
 
 struct Chunk;
 class Util
@@ -47,34 +48,35 @@ public:
         case Opcode::OP_GREATER:
         case Opcode::OP_LESS:
         case Opcode::OP_EQUAL:
+        case Opcode::OP_NOT_EQUAL:
+        case Opcode::OP_LESS_EQUAL:
+        case Opcode::OP_GREATER_EQUAL:
         case Opcode::OP_RETURN:
         case Opcode::OP_PRINT:
         case Opcode::OP_POP:
         case Opcode::OP_GET_ELEMENT:
+        case Opcode::OP_ADD_INT:
+        case Opcode::OP_ADD_STR:
+        case Opcode::OP_LESS_INT:
+        case Opcode::OP_GET_ELEMENT_ARRAY:
         case Opcode::OP_SET_ELEMENT:
         case Opcode::OP_INHERIT:
-        case Opcode::OP_JSON:
-        case Opcode::OP_BREAK:
-        case Opcode::OP_CONTINUE:
         case Opcode::OP_RESUME_COROUTINE:
-        case Opcode::OP_CREATE_COROUTINE:
         case Opcode::OP_YIELD_COROUTINE:
         {
             std::cout << "  " << instruction << std::endl;
             return offset + 1;
         }
+        case Opcode::OP_POPN:
         case Opcode::OP_ARRAY:
+        case Opcode::OP_JSON:
+        case Opcode::OP_CREATE_COROUTINE:
         {
             int count = chunk.bytecode_[offset + 1]; // can't use uint8 because unsigned char is null
             std::cout << "  " << instruction << " size: " << count << std::endl;
             return offset + 2;
         }
-        case Opcode::OP_GET_GLOBAL:
-        case Opcode::OP_DEFINE_GLOBAL:
-        case Opcode::OP_SET_GLOBAL:
         case Opcode::OP_CONSTANT:
-        case Opcode::OP_GET_PROPERTY:
-        case Opcode::OP_SET_PROPERTY:
         case Opcode::OP_METHOD:
         case Opcode::OP_CLASS:
         case Opcode::OP_FUNCTION:
@@ -84,6 +86,23 @@ public:
                       << std::endl;
             return offset + 2;
         }
+        case Opcode::OP_GET_PROPERTY:
+        case Opcode::OP_SET_PROPERTY:
+        {
+            int index = chunk.bytecode_[offset + 1];
+            int cache = (chunk.bytecode_[offset + 2] << 8) | chunk.bytecode_[offset + 3];
+            std::cout << "  " << instruction << " [" << index << "] " << chunk.constants_[index]
+                      << " cache " << cache << std::endl;
+            return offset + 4;
+        }
+        case Opcode::OP_GET_GLOBAL:
+        case Opcode::OP_DEFINE_GLOBAL:
+        case Opcode::OP_SET_GLOBAL:
+        {
+            int slot = (chunk.bytecode_[offset + 1] << 8) | chunk.bytecode_[offset + 2];
+            std::cout << "  " << instruction << " [" << slot << "] " << std::endl;
+            return offset + 3;
+        }
         case Opcode::OP_JUMP:
         case Opcode::OP_JUMP_IF_FALSE:
         {
@@ -93,6 +112,77 @@ public:
         {
             return jumpInstruction(-1, chunk, offset);
         }
+        case Opcode::OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL:
+        case Opcode::OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL:
+        case Opcode::OP_JUMP_IF_NOT_GREATER_LOCAL_LOCAL:
+        case Opcode::OP_JUMP_IF_EQUAL_LOCAL_LOCAL:
+        case Opcode::OP_JUMP_IF_LESS_LOCAL_LOCAL:
+        case Opcode::OP_JUMP_IF_GREATER_LOCAL_LOCAL:
+        case Opcode::OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST:
+        case Opcode::OP_JUMP_IF_NOT_LESS_LOCAL_CONST:
+        case Opcode::OP_JUMP_IF_NOT_GREATER_LOCAL_CONST:
+        case Opcode::OP_JUMP_IF_EQUAL_LOCAL_CONST:
+        case Opcode::OP_JUMP_IF_LESS_LOCAL_CONST:
+        case Opcode::OP_JUMP_IF_GREATER_LOCAL_CONST:
+        {
+            int slot = chunk.bytecode_[offset + 1];
+            int operand = chunk.bytecode_[offset + 2];
+            int jump = (chunk.bytecode_[offset + 3] << 8) | chunk.bytecode_[offset + 4];
+            std::cout << std::setfill(' ') << std::left << std::setw(16) << instruction << " [" << slot << "] ";
+            if (instruction >= Opcode::OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST)
+                std::cout << chunk.constants_[operand];
+            else
+                std::cout << "[" << operand << "]";
+            std::cout << ' ' << std::setw(4) << offset << " -> " << offset + 5 + jump << '\n';
+            return offset + 5;
+        }
+        case Opcode::OP_ADD_REG_REG:
+        case Opcode::OP_SUB_REG_REG:
+        case Opcode::OP_MUL_REG_REG:
+        case Opcode::OP_DIV_REG_REG:
+        case Opcode::OP_EQUAL_REG_REG:
+        case Opcode::OP_LESS_REG_REG:
+        case Opcode::OP_GREATER_REG_REG:
+        case Opcode::OP_ADD_REG_CONST:
+        case Opcode::OP_SUB_REG_CONST:
+        case Opcode::OP_MUL_REG_CONST:
+        case Opcode::OP_DIV_REG_CONST:
+        case Opcode::OP_EQUAL_REG_CONST:
+        case Opcode::OP_LESS_REG_CONST:
+        case Opcode::OP_GREATER_REG_CONST:
+        {
+            int target = chunk.bytecode_[offset + 1];
+            int left = chunk.bytecode_[offset + 2];
+            int right = chunk.bytecode_[offset + 3];
+            std::cout << "  " << instruction << " [" << target << "] [" << left << "] ";
+            if (instruction >= FIRST_REG_CONST)
+                std::cout << chunk.constants_[right] << std::endl;
+            else
+                std::cout << "[" << right << "]" << std::endl;
+            return offset + 4;
+        }
+        case Opcode::OP_NEGATE_REG:
+        case Opcode::OP_NOT_REG:
+        case Opcode::OP_MOVE_REG:
+        case Opcode::OP_LOAD_CONST:
+        {
+            int target = chunk.bytecode_[offset + 1];
+            int source = chunk.bytecode_[offset + 2];
+            std::cout << "  " << instruction << " [" << target << "] ";
+            if (instruction == Opcode::OP_LOAD_CONST)
+                std::cout << chunk.constants_[source] << std::endl;
+            else
+                std::cout << "[" << source << "]" << std::endl;
+            return offset + 3;
+        }
+        case Opcode::OP_BREAK:
+        case Opcode::OP_CONTINUE:
+        {
+            int target = (chunk.bytecode_[offset + 1] << 8) | chunk.bytecode_[offset + 2];
+            std::cout << std::setfill(' ') << std::left << std::setw(16) << instruction << ' ';
+            std::cout << std::setw(4) << offset << " -> " << target << '\n';
+            return offset + 3;
+        }
         case Opcode::OP_CLOSURE:
         {
             offset++;
@@ -105,8 +195,18 @@ public:
         {
             auto constant = chunk.bytecode_[offset + 1];
             auto argCount = chunk.bytecode_[offset + 2];
-            std::cout << "  " << Opcode(instruction) << "(args: " << int(argCount) << ") [" << int(constant) << "] " << chunk.constants_[constant] << std::endl;
-            return offset + 3;
+            int cache = (chunk.bytecode_[offset + 3] << 8) | chunk.bytecode_[offset + 4];
+            std::cout << "  " << Opcode(instruction) << "(args: " << int(argCount) << ") [" << int(constant) << "] " << chunk.constants_[constant]
+                      << " cache " << cache << std::endl;
+            return offset + 5;
+        }
+#define S(NAME, ...) case Opcode::NAME:
+            SUPERINSTRUCTIONS
+#undef S
+        {
+            // the run's own instructions follow, starting with the first one's operands
+            std::cout << "  " << instruction << " (" << first_component(instruction) << ")" << std::endl;
+            return offset + instruction_length(chunk, offset);
         }
         default:
             std::cout << "Unknown opcode " << instruction << std::endl;
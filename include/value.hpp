@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <ostream>
 #include <variant>
 #include <vector>
@@ -12,16 +13,82 @@ bool operator!=(const Value &v1, const Value &v2);
 bool operator==(const std::monostate nil, const Obj* obj);
 bool operator==(const Obj* obj, const std::monostate nil);
 
+#ifdef NAN_BOXING
+// every Value lives in one 64-bit word inside the quiet-NaN space:
+//   obj  : SIGN | QNAN | 48-bit pointer
+//   int  : QNAN | INT_TAG | 32-bit payload
+//   nil/false/true : QNAN | 1/2/3
+//   undefined      : QNAN | 4 (empty global slot, never seen by scripts)
+namespace nanbox
+{
+    constexpr uint64_t SIGN_BIT = 0x8000000000000000;
+    constexpr uint64_t QNAN = 0x7ffc000000000000;
+    constexpr uint64_t INT_TAG = 0x0001000000000000;
+    constexpr uint64_t OBJ_MASK = SIGN_BIT | QNAN;
+    constexpr uint64_t INT_MASK = SIGN_BIT | QNAN | INT_TAG;
+
+    constexpr uint64_t NIL_VAL = QNAN | 1;
+    constexpr uint64_t FALSE_VAL = QNAN | 2;
+    constexpr uint64_t TRUE_VAL = QNAN | 3;
+    constexpr uint64_t UNDEFINED_VAL = QNAN | 4;
+}
+#endif
+
 struct Value
 {
     static std::string value_to_string(Value value);
 
     Value operator-() const;
 
-    Value(bool value);
-    Value();
-    Value(int value);
-    Value(Obj *obj); 
+#ifdef NAN_BOXING
+    Value(bool value) : value_(value ? nanbox::TRUE_VAL : nanbox::FALSE_VAL) {}
+    Value() : value_(nanbox::NIL_VAL) {}
+    Value(int value) : value_(nanbox::QNAN | nanbox::INT_TAG | static_cast<uint32_t>(value)) {}
+    Value(Obj *obj) : value_(nanbox::OBJ_MASK | reinterpret_cast<uintptr_t>(obj)) {}
+
+    template <typename T>
+    T as() const
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            if (!is_bool())
+                throw std::bad_variant_access();
+            return value_ == nanbox::TRUE_VAL;
+        }
+        else if constexpr (std::is_same_v<T, int>)
+        {
+            if (!is_number())
+                throw std::bad_variant_access();
+            return static_cast<int>(static_cast<uint32_t>(value_));
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, Obj *>, "Value only holds bool, int, nil or Obj*");
+            if (!is_obj())
+                throw std::bad_variant_access();
+            return reinterpret_cast<Obj *>(value_ & ~nanbox::OBJ_MASK);
+        }
+    }
+
+    bool is_bool() const { return (value_ | 1) == nanbox::TRUE_VAL; }
+    bool is_nil() const { return value_ == nanbox::NIL_VAL; }
+    bool is_number() const { return (value_ & nanbox::INT_MASK) == (nanbox::QNAN | nanbox::INT_TAG); }
+    bool is_obj() const { return (value_ & nanbox::OBJ_MASK) == nanbox::OBJ_MASK; }
+
+    static Value undefined()
+    {
+        Value value;
+        value.value_ = nanbox::UNDEFINED_VAL;
+        return value;
+    }
+    bool is_undefined() const { return value_ == nanbox::UNDEFINED_VAL; }
+
+    using value_type = uint64_t;
+#else
+    Value(bool value) : value_(value) {}
+    Value() : value_(std::monostate()) {}
+    Value(int value) : value_(value) {}
+    Value(Obj *obj) : value_(obj) {}
 
     template <typename T>
     T as() const { return std::get<T>(value_); }
@@ -31,22 +98,36 @@ struct Value
     bool is_number() const { return std::holds_alternative<int>(value_); }
     bool is_obj() const { return std::holds_alternative<Obj *>(value_); }
 
+    // a null Obj* never appears as a script value, so it marks an empty global slot
+    static Value undefined() { return Value(static_cast<Obj *>(nullptr)); }
+    bool is_undefined() const { return is_obj() && std::get<Obj *>(value_) == nullptr; }
+
+    using value_type = std::variant<bool, int, std::monostate, Obj *>;
+#endif
+
     template <typename U>
     auto is_obj_type() const -> typename std::enable_if_t<std::is_base_of_v<Obj, U> && !std::is_same_v<Obj, U>, bool>;
 
     template <typename U>
     auto as_obj() const -> typename std::enable_if_t<std::is_base_of_v<Obj, U> && !std::is_same_v<Obj, U>, U *>;
 
-    using value_type = std::variant<bool, int, std::monostate, Obj *>;
     value_type value_;
 };
 
+#ifdef NAN_BOXING
+static_assert(sizeof(Value) == sizeof(uint64_t), "NaN-boxed Value must fit in one word");
+#endif
 
 
 namespace std {
     template <>
     struct hash<Value> {
         size_t operator()(const Value &v) const {
+#ifdef NAN_BOXING
+            if (v.is_nil())
+                return 0; // nil case, assign a constant hash
+            return std::hash<uint64_t>{}(v.value_); // objects still hash by obj_addr
+#else
             return std::visit([](auto&& arg) -> size_t {
                 using T = std::decay_t<decltype(arg)>;
                 if constexpr (std::is_same_v<T, bool>) {
@@ -59,6 +140,7 @@ namespace std {
                     return std::hash<Obj*>{}(arg);
                 }
             }, v.value_);
+#endif
         }
     };
 }
@@ -9,6 +9,9 @@
 #include "object.hpp"
 #include "scheduler.hpp"
 #include "common.hpp"
+#ifdef PROFILE_OPCODES
+#include "profile.hpp"
+#endif
 
 
 struct GC;
@@ -16,7 +19,7 @@ struct GC;
 class VM
 {
 public:
-    VM(); 
+    explicit VM(SchedulePolicy policy = SchedulePolicy::Fifo);
     InterpretResult run(ObjCoroutine* co);
 
     template <typename Operator>
@@ -26,15 +29,16 @@ public:
     void reset_stack();
     Value pop();
     Value peek(int distance);
+    bool concatenate(const Value& left, const Value& right, Value& result);
     void close_upvalues(Value* last);
     void define_method(ObjString* name);
     bool bind_method(ObjClass* klass, ObjString* name);
 
     bool call_value(const Value& callee, uint8_t arg_count);
     bool call(ObjClosure* closure, int argCount);
-    bool invoke(ObjString* name, int argCount);
+    bool invoke(ObjString* name, int argCount, InvokeCache& cache);
     bool invoke_from_class(ObjClass* klass, ObjString* name,
-                            int argCount); 
+                            int argCount, InvokeCache& cache, uint32_t shape_id = 0); 
 
 
     ObjUpvalue* capture_upvalue(Value* local);
@@ -43,15 +47,21 @@ public:
 	void runtime_error(Args&&... args);
 
     void define_native(std::string_view name, NativeFn function);
+    uint16_t global_slot(ObjString* name);
 
     InterpretResult interpret(const std::string& source);
 
     Complication cu_;
     ObjString* init_string_ = nullptr;
     ObjCoroutine* current_coroutine_ = nullptr;
-    Table globals_;
-    ObjUpvalue* open_upvalues_ = nullptr;
+    Table globals_;                       // name -> index into global_values_, resolved at compile time
+    std::vector<Value> global_values_;    // Value::undefined() until the global is defined
+    std::vector<ObjString*> global_names_;
+    Value result_;                        // what the main coroutine returned, which a worker sends back to join()
     GC gc_;
     Scheduler scheduler_;
+#ifdef PROFILE_OPCODES
+    OpcodeProfile profile_;
+#endif
     
 };
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "value.hpp"
+
+class VM;
+struct ObjCoroutine;
+
+// M:N coroutines: submit(co) runs a coroutine that has not started yet on a pool of worker threads. Every task
+// runs in a VM of its own, with its own heap, collector and scheduler, so no object is ever shared between
+// threads and each collector stops only its own VM at its safepoints. Before the task starts, its function,
+// its arguments and the globals their code names are copied into the worker's heap; join(co) copies the
+// value the function returned back. Functions travel with their constants and nested functions; closures
+// that captured variables, classes, instances and coroutines cannot be sent, and a global holding one is
+// left undefined on the worker, as is every global the code does not name.
+
+// a value copied out of one VM's heap, to be rebuilt in another's
+struct Portable
+{
+	enum class Kind { Undefined, Nil, Bool, Number, String, Array, Json, Function, Closure, Native };
+
+	struct Function
+	{
+		std::string name_; // empty for the script
+		int arity_ = 0;
+		int upvalue_count_ = 0;
+		std::vector<uint8_t> bytecode_;
+		std::vector<int> lines_;
+		std::vector<Portable> constants_;
+		size_t caches_ = 0; // the caches start empty on the other side
+		size_t invoke_caches_ = 0;
+	};
+
+	Kind kind_ = Kind::Nil;
+	bool boolean_ = false;
+	int number_ = 0;
+	std::string text_;								// String, and the name of a Native
+	std::vector<Portable> items_;					// Array elements, Json keys and values in turn
+	std::shared_ptr<const Function> function_; // Function and Closure, shared where the heap shared it
+};
+
+// a submitted coroutine: filled in by submit on the main thread, run by a worker, read back by join
+struct WorkerTask
+{
+	Portable closure_;
+	std::vector<Portable> arguments_;						// as ObjCoroutine::arguments_ keeps them
+	std::vector<std::pair<std::string, Portable>> globals_; // in slot order, Undefined where not sent
+
+	std::mutex mutex_;
+	std::condition_variable done_;
+	bool finished_ = false; // guarded by mutex_, and so are failed_ and result_
+	bool failed_ = false;	// a runtime error ended the task, or it returned a value that cannot be sent back
+	Portable result_;
+};
+
+// one queue of tasks per worker thread, filled round robin by submit: a worker takes the oldest task of its own
+// queue, and once that is empty steals the oldest of another's
+class WorkerPool
+{
+public:
+	inline static int size_ = 0; // threads of the pool, read when it starts on the first submit; 0: one per core
+
+	static WorkerPool &instance();
+	void submit(std::shared_ptr<WorkerTask> task);
+	~WorkerPool(); // drops the tasks no worker has taken yet
+
+private:
+	struct Deque
+	{
+		std::mutex mutex_;
+		std::deque<std::shared_ptr<WorkerTask>> tasks_;
+	};
+
+	explicit WorkerPool(size_t count);
+	std::shared_ptr<WorkerTask> take(size_t self);
+	void work(size_t self);
+
+	std::vector<Deque> deques_;
+	std::vector<std::thread> threads_;
+	std::mutex mutex_; // guards pending_ and stopping_, which idle workers wait on
+	std::condition_variable wake_;
+	size_t pending_ = 0; // tasks in the deques
+	bool stopping_ = false;
+	size_t next_ = 0; // deque of the next submit, round robin; only the main thread submits
+};
+
+// the submit(co) and join(co) natives; misuse throws std::runtime_error, which ends the script
+void submit_coroutine(VM &vm, ObjCoroutine *co);
+Value join_coroutine(VM &vm, ObjCoroutine *co); // nil if the task failed
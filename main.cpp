@@ -3,12 +3,33 @@
 #include "vm.hpp"
 #include "compiler.hpp"
 #include "memory.hpp"
+#include "workers.hpp"
 
 #include <iostream>
 #include <fstream>
+#include <string_view>
 
-static void REPL() {
-    VM vm;
+struct Options {
+    long gc_pause_us = -1; // -1: keep the collector's default (LOX_GC_PAUSE_US or stop-the-world)
+    long gc_threads = -1;  // -1: keep the collector's default (LOX_GC_THREADS or everything on the mutator)
+    bool fast_exit = false;
+    SchedulePolicy schedule = SchedulePolicy::Fifo;
+    Backend backend = Backend::Stack;
+};
+
+static void apply(const Options& options, VM& vm) {
+    if (options.gc_pause_us >= 0)
+        vm.gc_.pause_us_ = options.gc_pause_us;
+    if (options.gc_threads >= 0)
+        vm.gc_.gc_threads_ = static_cast<int>(options.gc_threads);
+    if (options.fast_exit)
+        vm.gc_.fast_exit_ = true;
+    vm.cu_.backend_ = options.backend;
+}
+
+static void REPL(const Options& options) {
+    VM vm(options.schedule);
+    apply(options, vm);
     std::string line;
     std::string codeBuffer;
 
@@ -53,9 +74,10 @@ static std::string readFile(const std::string& path) {
     return buffer; // Return the file content as a string
 }
 
-static void runFile(const std::string& path) {
+static void runFile(const std::string& path, const Options& options) {
     try {
-        VM vm;
+        VM vm(options.schedule);
+        apply(options, vm);
         std::string source = readFile(path);  // Automatically managed string
         InterpretResult result = vm.interpret(source);
 
@@ -69,10 +91,39 @@ static void runFile(const std::string& path) {
 
 int main(int argc, char** argv)
 {
-    if(argc == 1) {
-        REPL();
-    } else if(argc == 2) {
-        runFile(argv[1]);
+    Options options;
+    int arg = 1;
+    for (; arg < argc && std::string_view(argv[arg]).substr(0, 2) == "--"; arg++) {
+        std::string_view option = argv[arg];
+        constexpr std::string_view gc_pause = "--gc-pause-us=";
+        constexpr std::string_view gc_threads = "--gc-threads=";
+        constexpr std::string_view workers = "--workers=";
+        if (option.substr(0, gc_pause.size()) == gc_pause) {
+            options.gc_pause_us = std::max(0L, std::strtol(argv[arg] + gc_pause.size(), nullptr, 10));
+        } else if (option.substr(0, gc_threads.size()) == gc_threads) {
+            options.gc_threads = std::max(0L, std::strtol(argv[arg] + gc_threads.size(), nullptr, 10));
+        } else if (option.substr(0, workers.size()) == workers) {
+            WorkerPool::size_ = static_cast<int>(std::max(0L, std::strtol(argv[arg] + workers.size(), nullptr, 10)));
+        } else if (option == "--fast-exit") {
+            options.fast_exit = true;
+        } else if (option == "--schedule=fifo") {
+            options.schedule = SchedulePolicy::Fifo;
+        } else if (option == "--schedule=priority") {
+            options.schedule = SchedulePolicy::Priority;
+        } else if (option == "--backend=stack") {
+            options.backend = Backend::Stack;
+        } else if (option == "--backend=register") {
+            options.backend = Backend::Register;
+        } else {
+            std::cerr << "Unknown option " << option << std::endl;
+            exit(1);
+        }
+    }
+
+    if(arg == argc) {
+        REPL(options);
+    } else if(arg + 1 == argc) {
+        runFile(argv[arg], options);
     } else {
         exit(1);
     }
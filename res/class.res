@@ -1,238 +1,285 @@
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 96
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 192
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 136
-allocate: 80
-allocate: 40
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
 allocate: 16
+allocate: 8
+allocate: 32
+allocate: 32
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 56
+allocate: 16
+allocate: 4
+allocate: 16
+allocate: 8
 allocate: 32
-allocate: 64
-allocate: 136
-allocate: 80
-allocate: 40
 allocate: 16
+allocate: 16
+allocate: 64
+allocate: 12
+allocate: 48
 === "init"===
-allocate: 80
-allocate: 40
-allocate: 128
-allocate: 136
+allocate: 64
 allocate: 16
-allocate: 80
-allocate: 40
+allocate: 64
+allocate: 56
+allocate: 256
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 16
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 56
 allocate: 32
+allocate: 16
+allocate: 64
+allocate: 12
+allocate: 48
 === "speak"===
-allocate: 80
-allocate: 40
-allocate: 256
-allocate: 136
+allocate: 128
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
 allocate: 16
+allocate: 8
 allocate: 32
-allocate: 80
-allocate: 40
+allocate: 16
 allocate: 64
+allocate: 72
+allocate: 32
+allocate: 16
+allocate: 56
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 22
+allocate: 88
 === "speak"===
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 56
+allocate: 256
+allocate: 72
+allocate: 56
+allocate: 768
+allocate: 56
+allocate: 128
 allocate: 512
+allocate: 144
 allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
+allocate: 320
 === <script> ===
-allocate: 80
-allocate: 160
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
            stackframe: [ <closure <script>> ]
 0000   OP_CLASS [0] "Animal"
-allocate: 104
+allocate: 72
+allocate: 80
            stackframe: [ <closure <script>> ][ <class "Animal"> ]
-0002   OP_DEFINE_GLOBAL [0] "Animal"
-allocate: 56
+0002   OP_DEFINE_GLOBAL [9] 
            stackframe: [ <closure <script>> ]
-0004   OP_GET_GLOBAL [1] "Animal"
+0005   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <class "Animal"> ]
-0006   OP_CLOSURE [3] <fn "init">
-allocate: 80
+0008   OP_CLOSURE [2] <fn "init">
+allocate: 48
            stackframe: [ <closure <script>> ][ <class "Animal"> ][ <closure <fn "init">> ]
-0008   OP_METHOD [2] "init"
-allocate: 56
+0010   OP_METHOD [1] "init"
+allocate: 192
            stackframe: [ <closure <script>> ][ <class "Animal"> ]
-0010   OP_CLOSURE [5] <fn "speak">
-allocate: 80
+0012   OP_CLOSURE [4] <fn "speak">
+allocate: 48
            stackframe: [ <closure <script>> ][ <class "Animal"> ][ <closure <fn "speak">> ]
-0012   OP_METHOD [4] "speak"
-allocate: 56
+0014   OP_METHOD [3] "speak"
            stackframe: [ <closure <script>> ][ <class "Animal"> ]
-0014   OP_POP
+0016   OP_POP
            stackframe: [ <closure <script>> ]
-0015   OP_CLASS [6] "Dog"
-allocate: 104
+0017   OP_CLASS [5] "Dog"
+allocate: 72
+allocate: 80
            stackframe: [ <closure <script>> ][ <class "Dog"> ]
-0017   OP_DEFINE_GLOBAL [6] "Dog"
-allocate: 56
+0019   OP_DEFINE_GLOBAL [10] 
            stackframe: [ <closure <script>> ]
-0019   OP_GET_GLOBAL [7] "Animal"
+0022   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <class "Animal"> ]
-0021   OP_GET_GLOBAL [8] "Dog"
+0025   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ <class "Animal"> ][ <class "Dog"> ]
-0023   OP_INHERIT
-allocate: 56
-allocate: 56
+0028   OP_INHERIT
+allocate: 192
            stackframe: [ <closure <script>> ][ <class "Animal"> ]
-0024   OP_GET_GLOBAL [9] "Dog"
+0029   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ <class "Animal"> ][ <class "Dog"> ]
-0026   OP_CLOSURE [11] <fn "speak">
-allocate: 80
+0032   OP_CLOSURE [7] <fn "speak">
+allocate: 48
 allocate: 8
-allocate: 80
+allocate: 48
            stackframe: [ <closure <script>> ][ <class "Animal"> ][ <class "Dog"> ][ <closure <fn "speak">> ]
-0030   OP_METHOD [10] "speak"
+0036   OP_METHOD [6] "speak"
            stackframe: [ <closure <script>> ][ <class "Animal"> ][ <class "Dog"> ]
-0032   OP_POP
+0038   OP_POP
            stackframe: [ <closure <script>> ][ <class "Animal"> ]
-0033   OP_CLOSE_UPVALUE
+0039   OP_CLOSE_UPVALUE
            stackframe: [ <closure <script>> ]
-0034   OP_GET_GLOBAL [13] "Animal"
+0040   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <class "Animal"> ]
-0036   OP_CONSTANT [14] "Generic Animal"
+0043   OP_CONSTANT [8] "Generic Animal"
            stackframe: [ <closure <script>> ][ <class "Animal"> ][ "Generic Animal" ]
-0038   OP_CALL [1] 
-allocate: 104
+0045   OP_CALL [1] 
+allocate: 56
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal" ]
 0000   OP_GET_LOCAL [0] 
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal" ][ <instance <class "Animal">> ]
 0002   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal" ][ <instance <class "Animal">> ][ "Generic Animal" ]
-0004   OP_SET_PROPERTY [0] "name"
-allocate: 56
+0004   OP_SET_PROPERTY [0] "name" cache 0
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 16
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal" ][ "Generic Animal" ]
-0006   OP_POP
-           stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal" ]
-0007   OP_GET_LOCAL [0] 
+0008   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal" ][ <instance <class "Animal">> ]
-0009   OP_RETURN
+0011   OP_RETURN
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ]
-0040   OP_DEFINE_GLOBAL [12] "animal"
-allocate: 56
+0047   OP_DEFINE_GLOBAL [11] 
            stackframe: [ <closure <script>> ]
-0042   OP_GET_GLOBAL [15] "animal"
+0050   OP_GET_GLOBAL [11] 
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ]
-0044   OP_INVOKE(args: 0) [16] "speak"
+0053   OP_INVOKE(args: 0) [9] "speak" cache 0
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ]
 0000   OP_GET_LOCAL [0] 
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ <instance <class "Animal">> ]
-0002   OP_GET_PROPERTY [0] "name"
+0002   OP_GET_PROPERTY [0] "name" cache 0
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal" ]
-0004   OP_CONSTANT [1] " makes a sound."
+0006   OP_CONSTANT [1] " makes a sound."
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal" ][ " makes a sound." ]
-0006   OP_ADD
-allocate: 80
+0008   OP_ADD
+allocate: 56
 allocate: 31
-allocate: 40
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ "Generic Animal makes a sound." ]
-0007   OP_PRINT
+0009   OP_PRINT
 "Generic Animal makes a sound."
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ]
-0008   OP_NIL
+0010   OP_NIL
            stackframe: [ <closure <script>> ][ <instance <class "Animal">> ][ nil ]
-0009   OP_RETURN
+0011   OP_RETURN
            stackframe: [ <closure <script>> ][ nil ]
-0047   OP_POP
+0058   OP_POP
            stackframe: [ <closure <script>> ]
-0048   OP_GET_GLOBAL [18] "Dog"
+0059   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ <class "Dog"> ]
-0050   OP_CONSTANT [19] "Buddy"
+0062   OP_CONSTANT [10] "Buddy"
            stackframe: [ <closure <script>> ][ <class "Dog"> ][ "Buddy" ]
-0052   OP_CALL [1] 
-allocate: 104
+0064   OP_CALL [1] 
+allocate: 56
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy" ]
 0000   OP_GET_LOCAL [0] 
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy" ][ <instance <class "Dog">> ]
 0002   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy" ][ <instance <class "Dog">> ][ "Buddy" ]
-0004   OP_SET_PROPERTY [0] "name"
-allocate: 56
-gc collect 151 bytes
+0004   OP_SET_PROPERTY [0] "name" cache 0
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 16
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy" ][ "Buddy" ]
-0006   OP_POP
-           stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy" ]
-0007   OP_GET_LOCAL [0] 
+0008   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy" ][ <instance <class "Dog">> ]
-0009   OP_RETURN
+0011   OP_RETURN
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ]
-0054   OP_DEFINE_GLOBAL [17] "dog"
-allocate: 56
+0066   OP_DEFINE_GLOBAL [12] 
            stackframe: [ <closure <script>> ]
-0056   OP_GET_GLOBAL [20] "dog"
+0069   OP_GET_GLOBAL [12] 
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ]
-0058   OP_INVOKE(args: 0) [21] "speak"
+0072   OP_INVOKE(args: 0) [11] "speak" cache 1
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ]
 0000   OP_GET_LOCAL [0] 
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ]
 0002   OP_GET_UPVALUE [0] 
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ][ <class "Animal"> ]
-0004   OP_SUPER_INVOKE(args: 0) [0] "speak"
+0004   OP_SUPER_INVOKE(args: 0) [0] "speak" cache 0
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ]
 0000   OP_GET_LOCAL [0] 
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ]
-0002   OP_GET_PROPERTY [0] "name"
+0002   OP_GET_PROPERTY [0] "name" cache 0
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ][ "Buddy" ]
-0004   OP_CONSTANT [1] " makes a sound."
+0006   OP_CONSTANT [1] " makes a sound."
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ][ "Buddy" ][ " makes a sound." ]
-0006   OP_ADD
-allocate: 80
+0008   OP_ADD_STR
+allocate: 56
 allocate: 31
-allocate: 40
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ][ "Buddy makes a sound." ]
-0007   OP_PRINT
+0009   OP_PRINT
 "Buddy makes a sound."
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ]
-0008   OP_NIL
+0010   OP_NIL
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ][ nil ]
-0009   OP_RETURN
+0011   OP_RETURN
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ nil ]
-0007   OP_POP
-           stackframe: [ <closure <script>> ][ <instance <class "Dog">> ]
-0008   OP_GET_LOCAL [0] 
+0009   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ <instance <class "Dog">> ]
-0010   OP_GET_PROPERTY [1] "name"
+0012   OP_GET_PROPERTY [1] "name" cache 0
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy" ]
-0012   OP_CONSTANT [2] " barks."
+0016   OP_CONSTANT [2] " barks."
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy" ][ " barks." ]
-0014   OP_ADD
-allocate: 80
-allocate: 40
-gc collect 151 bytes
+0018   OP_ADD
+allocate: 56
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ "Buddy barks." ]
-0015   OP_PRINT
+0019   OP_PRINT
 "Buddy barks."
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ]
-0016   OP_NIL
+0020   OP_NIL
            stackframe: [ <closure <script>> ][ <instance <class "Dog">> ][ nil ]
-0017   OP_RETURN
+0021   OP_RETURN
            stackframe: [ <closure <script>> ][ nil ]
-0061   OP_POP
+0077   OP_POP
            stackframe: [ <closure <script>> ]
-0062   OP_NIL
+0078   OP_NIL
            stackframe: [ <closure <script>> ][ nil ]
-0063   OP_RETURN
+0079   OP_RETURN
@@ -1,106 +1,161 @@
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 136
-allocate: 80
-allocate: 40
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 152
+allocate: 152
+allocate: 56
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
 allocate: 16
-allocate: 136
-allocate: 136
-allocate: 80
-allocate: 40
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
 === "closure"===
 allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 9
+allocate: 36
 === "makeClosure"===
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 256
 allocate: 32
-allocate: 80
-allocate: 40
+allocate: 16
 allocate: 64
+allocate: 56
+allocate: 32
 allocate: 128
-allocate: 80
-allocate: 40
+allocate: 64
+allocate: 64
 allocate: 256
-allocate: 80
-allocate: 40
-allocate: 136
+allocate: 56
+allocate: 768
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 152
+allocate: 56
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
 allocate: 16
-allocate: 136
-allocate: 80
-allocate: 40
+allocate: 4
 allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 13
+allocate: 52
 === "counter"===
 allocate: 32
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 11
+allocate: 44
 === "makeCounter"===
-allocate: 80
-allocate: 40
+allocate: 56
+allocate: 64
+allocate: 256
 === <script> ===
-allocate: 80
-allocate: 160
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
            stackframe: [ <closure <script>> ]
-0000   OP_CLOSURE [1] <fn "makeClosure">
-allocate: 80
+0000   OP_CLOSURE [0] <fn "makeClosure">
+allocate: 48
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ]
-0002   OP_DEFINE_GLOBAL [0] "makeClosure"
-allocate: 56
+0002   OP_DEFINE_GLOBAL [9] 
            stackframe: [ <closure <script>> ]
-0004   OP_GET_GLOBAL [3] "makeClosure"
+0005   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ]
-0006   OP_CONSTANT [4] "doughnut"
+0008   OP_CONSTANT [1] "doughnut"
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ][ "doughnut" ]
-0008   OP_CALL [1] 
+0010   OP_CALL [1] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ][ "doughnut" ]
 0000   OP_CLOSURE [0] <fn "closure">
-allocate: 80
+allocate: 48
 allocate: 8
-allocate: 80
+allocate: 48
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ][ "doughnut" ][ <closure <fn "closure">> ]
 0004   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ][ "doughnut" ][ <closure <fn "closure">> ][ <closure <fn "closure">> ]
 0006   OP_RETURN
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ]
-0010   OP_DEFINE_GLOBAL [2] "doughnut"
-allocate: 56
+0012   OP_DEFINE_GLOBAL [10] 
            stackframe: [ <closure <script>> ]
-0012   OP_GET_GLOBAL [6] "makeClosure"
+0015   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ]
-0014   OP_CONSTANT [7] "bagel"
+0018   OP_CONSTANT [2] "bagel"
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ][ "bagel" ]
-0016   OP_CALL [1] 
+0020   OP_CALL [1] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ][ "bagel" ]
 0000   OP_CLOSURE [0] <fn "closure">
-allocate: 80
+allocate: 48
 allocate: 8
-allocate: 80
+allocate: 48
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ][ "bagel" ][ <closure <fn "closure">> ]
 0004   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeClosure">> ][ "bagel" ][ <closure <fn "closure">> ][ <closure <fn "closure">> ]
 0006   OP_RETURN
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ]
-0018   OP_DEFINE_GLOBAL [5] "bagel"
-allocate: 56
+0022   OP_DEFINE_GLOBAL [11] 
            stackframe: [ <closure <script>> ]
-0020   OP_GET_GLOBAL [8] "doughnut"
+0025   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ]
-0022   OP_CALL [0] 
+0028   OP_CALL [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ]
 0000   OP_GET_UPVALUE [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ][ "doughnut" ]
@@ -111,11 +166,11 @@ allocate: 56
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ][ nil ]
 0004   OP_RETURN
            stackframe: [ <closure <script>> ][ nil ]
-0024   OP_POP
+0030   OP_POP
            stackframe: [ <closure <script>> ]
-0025   OP_GET_GLOBAL [9] "bagel"
+0031   OP_GET_GLOBAL [11] 
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ]
-0027   OP_CALL [0] 
+0034   OP_CALL [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ]
 0000   OP_GET_UPVALUE [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ][ "bagel" ]
@@ -126,35 +181,33 @@ allocate: 56
            stackframe: [ <closure <script>> ][ <closure <fn "closure">> ][ nil ]
 0004   OP_RETURN
            stackframe: [ <closure <script>> ][ nil ]
-0029   OP_POP
+0036   OP_POP
            stackframe: [ <closure <script>> ]
-0030   OP_CLOSURE [11] <fn "makeCounter">
-allocate: 80
+0037   OP_CLOSURE [3] <fn "makeCounter">
+allocate: 48
            stackframe: [ <closure <script>> ][ <closure <fn "makeCounter">> ]
-0032   OP_DEFINE_GLOBAL [10] "makeCounter"
-allocate: 56
+0039   OP_DEFINE_GLOBAL [12] 
            stackframe: [ <closure <script>> ]
-0034   OP_GET_GLOBAL [13] "makeCounter"
+0042   OP_GET_GLOBAL [12] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeCounter">> ]
-0036   OP_CALL [0] 
+0045   OP_CALL [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeCounter">> ]
 0000   OP_CONSTANT [0] 0
            stackframe: [ <closure <script>> ][ <closure <fn "makeCounter">> ][ 0 ]
 0002   OP_CLOSURE [1] <fn "counter">
-allocate: 80
+allocate: 48
 allocate: 8
-allocate: 80
+allocate: 48
            stackframe: [ <closure <script>> ][ <closure <fn "makeCounter">> ][ 0 ][ <closure <fn "counter">> ]
 0006   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ <closure <fn "makeCounter">> ][ 0 ][ <closure <fn "counter">> ][ <closure <fn "counter">> ]
 0008   OP_RETURN
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ]
-0038   OP_DEFINE_GLOBAL [12] "counterA"
-allocate: 56
+0047   OP_DEFINE_GLOBAL [13] 
            stackframe: [ <closure <script>> ]
-0040   OP_GET_GLOBAL [14] "counterA"
+0050   OP_GET_GLOBAL [13] 
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ]
-0042   OP_CALL [0] 
+0053   OP_CALL [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ]
 0000   OP_GET_UPVALUE [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 0 ]
@@ -170,18 +223,18 @@ allocate: 56
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 1 ]
 0010   OP_RETURN
            stackframe: [ <closure <script>> ][ 1 ]
-0044   OP_PRINT
+0055   OP_PRINT
 1
            stackframe: [ <closure <script>> ]
-0045   OP_GET_GLOBAL [15] "counterA"
+0056   OP_GET_GLOBAL [13] 
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ]
-0047   OP_CALL [0] 
+0059   OP_CALL [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ]
 0000   OP_GET_UPVALUE [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 1 ]
 0002   OP_CONSTANT [0] 1
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 1 ][ 1 ]
-0004   OP_ADD
+0004   OP_ADD_INT
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 2 ]
 0005   OP_SET_UPVALUE [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 2 ]
@@ -191,9 +244,9 @@ allocate: 56
            stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 2 ]
 0010   OP_RETURN
            stackframe: [ <closure <script>> ][ 2 ]
-0049   OP_PRINT
+0061   OP_PRINT
 2
            stackframe: [ <closure <script>> ]
-0050   OP_NIL
+0062   OP_NIL
            stackframe: [ <closure <script>> ][ nil ]
-0051   OP_RETURN
+0063   OP_RETURN
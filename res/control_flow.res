@@ -1,1355 +1,1518 @@
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 96
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 384
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
+allocate: 152
 allocate: 56
-allocate: 136
-allocate: 80
-allocate: 40
 allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
 allocate: 32
+allocate: 16
 allocate: 64
+allocate: 64
+allocate: 32
+allocate: 128
 allocate: 128
+allocate: 64
+allocate: 256
 allocate: 256
-allocate: 80
-allocate: 40
+allocate: 128
 allocate: 512
+allocate: 56
+allocate: 256
 allocate: 1024
-allocate: 80
+allocate: 512
+allocate: 56
 allocate: 31
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 80
+allocate: 256
+allocate: 56
+allocate: 56
 allocate: 31
-allocate: 40
+allocate: 56
+allocate: 512
+allocate: 2048
+allocate: 1024
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 16
+allocate: 32
+allocate: 128
+allocate: 32
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 64
+allocate: 128
+allocate: 128
+allocate: 512
+allocate: 70
+allocate: 280
+=== "countdown"===
+allocate: 56
+allocate: 768
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 32
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 128
+allocate: 128
+allocate: 512
+allocate: 56
+allocate: 81
+allocate: 324
+=== "repeat"===
+allocate: 56
+allocate: 309
+allocate: 1236
 === <script> ===
-allocate: 80
-allocate: 160
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
            stackframe: [ <closure <script>> ]
-0000   OP_CONSTANT [1] 0
+0000   OP_CONSTANT [0] 0
            stackframe: [ <closure <script>> ][ 0 ]
-0002   OP_DEFINE_GLOBAL [0] "sum"
-allocate: 56
+0002   OP_DEFINE_GLOBAL [9] 
            stackframe: [ <closure <script>> ]
-0004   OP_CONSTANT [2] 0
+0005   OP_CONSTANT [1] 0
            stackframe: [ <closure <script>> ][ 0 ]
-0006   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0008   OP_CONSTANT [3] 3
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 3 ]
-0010   OP_LESS
-           stackframe: [ <closure <script>> ][ 0 ][ true ]
-0011 OP_JUMP_IF_FALSE 11   -> 126
-           stackframe: [ <closure <script>> ][ 0 ][ true ]
-0014   OP_POP
+0007 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 3 7    -> 121
            stackframe: [ <closure <script>> ][ 0 ]
-0015 OP_JUMP          15   -> 29
+0012 OP_JUMP          12   -> 26
            stackframe: [ <closure <script>> ][ 0 ]
-0029   OP_CONSTANT [5] 0
+0026   OP_CONSTANT [4] 0
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ true ]
-0039   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ][ 1 ]
-0058   OP_EQUAL
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ false ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ false ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ false ]
-0078   OP_POP
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0079   OP_GET_LOCAL [1] 
+0071   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ]
-0081   OP_CONSTANT [10] 2
+0074   OP_CONSTANT [9] 2
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ][ 2 ]
-0083   OP_EQUAL
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ false ]
-0084 OP_JUMP_IF_FALSE 84   -> 93
+0076   OP_EQUAL
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ false ]
-0093 OP_JUMP_IF_FALSE 93   -> 103
+0077 OP_JUMP_IF_FALSE 77   -> 96
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ false ]
-0103   OP_POP
+0096   OP_POP
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0104   OP_GET_GLOBAL [13] "sum"
+0097   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ]
-0106   OP_GET_LOCAL [1] 
+0100   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ][ 0 ]
-0108   OP_GET_LOCAL [2] 
+0102   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ][ 0 ][ 0 ]
-0110   OP_MUL
+0104   OP_MUL
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ][ 0 ]
-0111   OP_ADD
+0105   OP_ADD
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ]
-0112   OP_SET_GLOBAL [12] "sum"
+0106   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ]
-0114   OP_POP
+0109   OP_POP
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0115   OP_GET_GLOBAL [14] "sum"
+0110   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ]
-0117   OP_PRINT
+0113   OP_PRINT
 0
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0118 OP_LOOP          118  -> 43
+0114 OP_LOOP          114  -> 36
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0043   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ]
-0045   OP_CONSTANT [7] 1
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 0 ][ 1 ]
-0047   OP_ADD
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 1 ]
-0048   OP_SET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 1 ]
-0050   OP_POP
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0051 OP_LOOP          51   -> 31
+0036   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 1 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 1 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ true ]
-0039   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ][ 1 ]
-0058   OP_EQUAL
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ false ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ false ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ false ]
-0078   OP_POP
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0079   OP_GET_LOCAL [1] 
+0071   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ]
-0081   OP_CONSTANT [10] 2
+0074   OP_CONSTANT [9] 2
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ][ 2 ]
-0083   OP_EQUAL
+0076   OP_EQUAL
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ false ]
-0084 OP_JUMP_IF_FALSE 84   -> 93
+0077 OP_JUMP_IF_FALSE 77   -> 96
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ false ]
-0093 OP_JUMP_IF_FALSE 93   -> 103
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ false ]
-0103   OP_POP
+0096   OP_POP
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0104   OP_GET_GLOBAL [13] "sum"
+0097   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ]
-0106   OP_GET_LOCAL [1] 
+0100   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ][ 0 ]
-0108   OP_GET_LOCAL [2] 
+0102   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ][ 0 ][ 1 ]
-0110   OP_MUL
+0104   OP_MUL
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ][ 0 ]
-0111   OP_ADD
+0105   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ]
-0112   OP_SET_GLOBAL [12] "sum"
+0106   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ]
-0114   OP_POP
+0109   OP_POP
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0115   OP_GET_GLOBAL [14] "sum"
+0110   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 0 ]
-0117   OP_PRINT
+0113   OP_PRINT
 0
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0118 OP_LOOP          118  -> 43
+0114 OP_LOOP          114  -> 36
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0043   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 1 ]
-0045   OP_CONSTANT [7] 1
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 1 ][ 1 ]
-0047   OP_ADD
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ][ 2 ]
-0048   OP_SET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 2 ]
-0050   OP_POP
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0051 OP_LOOP          51   -> 31
+0036   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 2 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 2 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ true ]
-0039   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ][ 1 ]
-0058   OP_EQUAL
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ false ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ false ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ false ]
-0078   OP_POP
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0079   OP_GET_LOCAL [1] 
+0071   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ]
-0081   OP_CONSTANT [10] 2
+0074   OP_CONSTANT [9] 2
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ][ 2 ]
-0083   OP_EQUAL
+0076   OP_EQUAL
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ false ]
-0084 OP_JUMP_IF_FALSE 84   -> 93
+0077 OP_JUMP_IF_FALSE 77   -> 96
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ false ]
-0093 OP_JUMP_IF_FALSE 93   -> 103
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ false ]
-0103   OP_POP
+0096   OP_POP
            stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0104   OP_GET_GLOBAL [13] "sum"
+0097   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ]
-0106   OP_GET_LOCAL [1] 
+0100   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ][ 0 ]
-0108   OP_GET_LOCAL [2] 
+0102   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ][ 0 ][ 2 ]
-0110   OP_MUL
+0104   OP_MUL
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ][ 0 ]
-0111   OP_ADD
+0105   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ]
-0112   OP_SET_GLOBAL [12] "sum"
+0106   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ]
-0114   OP_POP
+0109   OP_POP
            stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0115   OP_GET_GLOBAL [14] "sum"
+0110   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 0 ]
-0117   OP_PRINT
+0113   OP_PRINT
 0
            stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0118 OP_LOOP          118  -> 43
+0114 OP_LOOP          114  -> 36
            stackframe: [ <closure <script>> ][ 0 ][ 2 ]
-0043   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 2 ]
-0045   OP_CONSTANT [7] 1
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 2 ][ 1 ]
-0047   OP_ADD
-           stackframe: [ <closure <script>> ][ 0 ][ 2 ][ 3 ]
-0048   OP_SET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 3 ][ 3 ]
-0050   OP_POP
-           stackframe: [ <closure <script>> ][ 0 ][ 3 ]
-0051 OP_LOOP          51   -> 31
+0036   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 0 ][ 3 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 0 ][ 3 ][ 3 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 0 ][ 3 ][ 3 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 0 ][ 3 ][ false ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 0 ][ 3 ][ false ]
-0121   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 0 ][ 3 ]
-0122   OP_POP
+0117   OP_POP
            stackframe: [ <closure <script>> ][ 0 ]
-0123 OP_LOOP          123  -> 18
+0118 OP_LOOP          118  -> 15
            stackframe: [ <closure <script>> ][ 0 ]
-0018   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0020   OP_CONSTANT [4] 1
-           stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 1 ]
-0022   OP_ADD
-           stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0023   OP_SET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0025   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ]
-0026 OP_LOOP          26   -> 6
+0015   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 1 ]
-0006   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0008   OP_CONSTANT [3] 3
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 3 ]
-0010   OP_LESS
-           stackframe: [ <closure <script>> ][ 1 ][ true ]
-0011 OP_JUMP_IF_FALSE 11   -> 126
-           stackframe: [ <closure <script>> ][ 1 ][ true ]
-0014   OP_POP
+0007 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 3 7    -> 121
            stackframe: [ <closure <script>> ][ 1 ]
-0015 OP_JUMP          15   -> 29
+0012 OP_JUMP          12   -> 26
            stackframe: [ <closure <script>> ][ 1 ]
-0029   OP_CONSTANT [5] 0
+0026   OP_CONSTANT [4] 0
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ true ]
-0039   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 1 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 1 ][ 1 ]
-0058   OP_EQUAL
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ true ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ true ]
-0062   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0063   OP_GET_LOCAL [2] 
+0055   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ]
-0065   OP_CONSTANT [9] 1
+0058   OP_CONSTANT [8] 1
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ][ 1 ]
-0067   OP_EQUAL
+0060   OP_EQUAL
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ false ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
+0061 OP_JUMP_IF_FALSE 61   -> 71
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ false ]
-0078   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0079   OP_GET_LOCAL [1] 
+0071   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 1 ]
-0081   OP_CONSTANT [10] 2
+0074   OP_CONSTANT [9] 2
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 1 ][ 2 ]
-0083   OP_EQUAL
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ false ]
-0084 OP_JUMP_IF_FALSE 84   -> 93
+0076   OP_EQUAL
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ false ]
-0093 OP_JUMP_IF_FALSE 93   -> 103
+0077 OP_JUMP_IF_FALSE 77   -> 96
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ false ]
-0103   OP_POP
+0096   OP_POP
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0104   OP_GET_GLOBAL [13] "sum"
+0097   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ]
-0106   OP_GET_LOCAL [1] 
+0100   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ][ 1 ]
-0108   OP_GET_LOCAL [2] 
+0102   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ][ 1 ][ 0 ]
-0110   OP_MUL
+0104   OP_MUL
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ][ 0 ]
-0111   OP_ADD
+0105   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ]
-0112   OP_SET_GLOBAL [12] "sum"
+0106   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ]
-0114   OP_POP
+0109   OP_POP
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0115   OP_GET_GLOBAL [14] "sum"
+0110   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ]
-0117   OP_PRINT
+0113   OP_PRINT
 0
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0118 OP_LOOP          118  -> 43
+0114 OP_LOOP          114  -> 36
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0043   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ]
-0045   OP_CONSTANT [7] 1
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 0 ][ 1 ]
-0047   OP_ADD
-           stackframe: [ <closure <script>> ][ 1 ][ 0 ][ 1 ]
-0048   OP_SET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ]
-0050   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0051 OP_LOOP          51   -> 31
+0036   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ true ]
-0039   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ][ 1 ]
-0058   OP_EQUAL
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 1 ][ 1 ][ true ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 1 ][ 1 ][ true ]
-0062   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0063   OP_GET_LOCAL [2] 
+0055   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ]
-0065   OP_CONSTANT [9] 1
+0058   OP_CONSTANT [8] 1
            stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ][ 1 ]
-0067   OP_EQUAL
+0060   OP_EQUAL
            stackframe: [ <closure <script>> ][ 1 ][ 1 ][ true ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
+0061 OP_JUMP_IF_FALSE 61   -> 71
            stackframe: [ <closure <script>> ][ 1 ][ 1 ][ true ]
-0071   OP_POP
+0064   OP_POP
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0072   OP_CONTINUE
+0065 OP_CONTINUE      65   -> 36
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0043   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ]
-0045   OP_CONSTANT [7] 1
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ][ 1 ]
-0047   OP_ADD
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 2 ]
-0048   OP_SET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ]
-0050   OP_POP
+0036   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0051 OP_LOOP          51   -> 31
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ true ]
-0039   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 1 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 1 ][ 1 ]
-0058   OP_EQUAL
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ true ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ true ]
-0062   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0063   OP_GET_LOCAL [2] 
+0055   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ]
-0065   OP_CONSTANT [9] 1
+0058   OP_CONSTANT [8] 1
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ][ 1 ]
-0067   OP_EQUAL
+0060   OP_EQUAL
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ false ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
+0061 OP_JUMP_IF_FALSE 61   -> 71
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ false ]
-0078   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0079   OP_GET_LOCAL [1] 
+0071   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 1 ]
-0081   OP_CONSTANT [10] 2
+0074   OP_CONSTANT [9] 2
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 1 ][ 2 ]
-0083   OP_EQUAL
+0076   OP_EQUAL
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ false ]
-0084 OP_JUMP_IF_FALSE 84   -> 93
+0077 OP_JUMP_IF_FALSE 77   -> 96
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ false ]
-0093 OP_JUMP_IF_FALSE 93   -> 103
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ false ]
-0103   OP_POP
+0096   OP_POP
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0104   OP_GET_GLOBAL [13] "sum"
+0097   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 0 ]
-0106   OP_GET_LOCAL [1] 
+0100   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 0 ][ 1 ]
-0108   OP_GET_LOCAL [2] 
+0102   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 0 ][ 1 ][ 2 ]
-0110   OP_MUL
+0104   OP_MUL
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 0 ][ 2 ]
-0111   OP_ADD
+0105   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ]
-0112   OP_SET_GLOBAL [12] "sum"
+0106   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ]
-0114   OP_POP
+0109   OP_POP
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0115   OP_GET_GLOBAL [14] "sum"
+0110   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ]
-0117   OP_PRINT
+0113   OP_PRINT
 2
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0118 OP_LOOP          118  -> 43
+0114 OP_LOOP          114  -> 36
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0043   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ]
-0045   OP_CONSTANT [7] 1
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ][ 1 ]
-0047   OP_ADD
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 3 ]
-0048   OP_SET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 3 ][ 3 ]
-0050   OP_POP
+0036   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 1 ][ 3 ]
-0051 OP_LOOP          51   -> 31
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 1 ][ 3 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 1 ][ 3 ][ 3 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 1 ][ 3 ][ 3 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 1 ][ 3 ][ false ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 1 ][ 3 ][ false ]
-0121   OP_POP
-           stackframe: [ <closure <script>> ][ 1 ][ 3 ]
-0122   OP_POP
+0117   OP_POP
            stackframe: [ <closure <script>> ][ 1 ]
-0123 OP_LOOP          123  -> 18
+0118 OP_LOOP          118  -> 15
            stackframe: [ <closure <script>> ][ 1 ]
-0018   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0020   OP_CONSTANT [4] 1
-           stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 1 ]
-0022   OP_ADD
-           stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0023   OP_SET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0025   OP_POP
+0015   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 2 ]
-0026 OP_LOOP          26   -> 6
+0007 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 3 7    -> 121
            stackframe: [ <closure <script>> ][ 2 ]
-0006   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0008   OP_CONSTANT [3] 3
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 3 ]
-0010   OP_LESS
-           stackframe: [ <closure <script>> ][ 2 ][ true ]
-0011 OP_JUMP_IF_FALSE 11   -> 126
-           stackframe: [ <closure <script>> ][ 2 ][ true ]
-0014   OP_POP
-           stackframe: [ <closure <script>> ][ 2 ]
-0015 OP_JUMP          15   -> 29
+0012 OP_JUMP          12   -> 26
            stackframe: [ <closure <script>> ][ 2 ]
-0029   OP_CONSTANT [5] 0
+0026   OP_CONSTANT [4] 0
            stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 0 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 0 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ true ]
-0039   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ][ 1 ]
-0058   OP_EQUAL
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ false ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ false ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ false ]
-0078   OP_POP
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0079   OP_GET_LOCAL [1] 
+0071   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ]
-0081   OP_CONSTANT [10] 2
+0074   OP_CONSTANT [9] 2
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ][ 2 ]
-0083   OP_EQUAL
+0076   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ true ]
-0084 OP_JUMP_IF_FALSE 84   -> 93
+0077 OP_JUMP_IF_FALSE 77   -> 96
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ true ]
-0087   OP_POP
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0088   OP_GET_LOCAL [2] 
+0080   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 0 ]
-0090   OP_CONSTANT [11] 2
+0083   OP_CONSTANT [10] 2
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 0 ][ 2 ]
-0092   OP_EQUAL
+0085   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ false ]
-0093 OP_JUMP_IF_FALSE 93   -> 103
+0086 OP_JUMP_IF_FALSE 86   -> 96
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ false ]
-0103   OP_POP
+0096   OP_POP
            stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0104   OP_GET_GLOBAL [13] "sum"
+0097   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ]
-0106   OP_GET_LOCAL [1] 
+0100   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ][ 2 ]
-0108   OP_GET_LOCAL [2] 
+0102   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ][ 2 ][ 0 ]
-0110   OP_MUL
+0104   OP_MUL
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ][ 0 ]
-0111   OP_ADD
+0105   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ]
-0112   OP_SET_GLOBAL [12] "sum"
+0106   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ]
-0114   OP_POP
+0109   OP_POP
            stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0115   OP_GET_GLOBAL [14] "sum"
+0110   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 2 ]
-0117   OP_PRINT
+0113   OP_PRINT
 2
            stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0118 OP_LOOP          118  -> 43
+0114 OP_LOOP          114  -> 36
            stackframe: [ <closure <script>> ][ 2 ][ 0 ]
-0043   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 0 ]
-0045   OP_CONSTANT [7] 1
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 0 ][ 1 ]
-0047   OP_ADD
-           stackframe: [ <closure <script>> ][ 2 ][ 0 ][ 1 ]
-0048   OP_SET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 1 ]
-0050   OP_POP
+0036   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0051 OP_LOOP          51   -> 31
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 1 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 1 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ true ]
-0039   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ][ 1 ]
-0058   OP_EQUAL
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ false ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ false ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ false ]
-0078   OP_POP
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0079   OP_GET_LOCAL [1] 
+0071   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ]
-0081   OP_CONSTANT [10] 2
+0074   OP_CONSTANT [9] 2
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ][ 2 ]
-0083   OP_EQUAL
+0076   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ true ]
-0084 OP_JUMP_IF_FALSE 84   -> 93
+0077 OP_JUMP_IF_FALSE 77   -> 96
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ true ]
-0087   OP_POP
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0088   OP_GET_LOCAL [2] 
+0080   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 1 ]
-0090   OP_CONSTANT [11] 2
+0083   OP_CONSTANT [10] 2
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 1 ][ 2 ]
-0092   OP_EQUAL
+0085   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ false ]
-0093 OP_JUMP_IF_FALSE 93   -> 103
+0086 OP_JUMP_IF_FALSE 86   -> 96
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ false ]
-0103   OP_POP
+0096   OP_POP
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0104   OP_GET_GLOBAL [13] "sum"
+0097   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ]
-0106   OP_GET_LOCAL [1] 
+0100   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ][ 2 ]
-0108   OP_GET_LOCAL [2] 
+0102   OP_GET_LOCAL [2] 
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ][ 2 ][ 1 ]
-0110   OP_MUL
+0104   OP_MUL
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ][ 2 ]
-0111   OP_ADD
+0105   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 4 ]
-0112   OP_SET_GLOBAL [12] "sum"
+0106   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 4 ]
-0114   OP_POP
+0109   OP_POP
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0115   OP_GET_GLOBAL [14] "sum"
+0110   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 4 ]
-0117   OP_PRINT
+0113   OP_PRINT
 4
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0118 OP_LOOP          118  -> 43
+0114 OP_LOOP          114  -> 36
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0043   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 1 ]
-0045   OP_CONSTANT [7] 1
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 1 ][ 1 ]
-0047   OP_ADD
-           stackframe: [ <closure <script>> ][ 2 ][ 1 ][ 2 ]
-0048   OP_SET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ]
-0050   OP_POP
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0051 OP_LOOP          51   -> 31
+0036   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0031   OP_GET_LOCAL [2] 
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ]
-0033   OP_CONSTANT [6] 3
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ][ 3 ]
-0035   OP_LESS
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ true ]
-0036 OP_JUMP_IF_FALSE 36   -> 121
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ true ]
-0039   OP_POP
+0028 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 3 28   -> 117
            stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0040 OP_JUMP          40   -> 54
+0033 OP_JUMP          33   -> 47
            stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0054   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ]
-0056   OP_CONSTANT [8] 1
+0047   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ][ 1 ]
-0058   OP_EQUAL
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ false ]
-0059 OP_JUMP_IF_FALSE 59   -> 68
+0051   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ false ]
-0068 OP_JUMP_IF_FALSE 68   -> 78
+0052 OP_JUMP_IF_FALSE 52   -> 71
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ false ]
-0078   OP_POP
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0079   OP_GET_LOCAL [1] 
+0071   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ]
-0081   OP_CONSTANT [10] 2
+0074   OP_CONSTANT [9] 2
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ][ 2 ]
-0083   OP_EQUAL
+0076   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ true ]
-0084 OP_JUMP_IF_FALSE 84   -> 93
+0077 OP_JUMP_IF_FALSE 77   -> 96
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ true ]
-0087   OP_POP
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0088   OP_GET_LOCAL [2] 
+0080   OP_SUPER_POP_GET_LOCAL (OP_POP)
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ]
-0090   OP_CONSTANT [11] 2
+0083   OP_CONSTANT [10] 2
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 2 ][ 2 ]
-0092   OP_EQUAL
+0085   OP_EQUAL
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ true ]
-0093 OP_JUMP_IF_FALSE 93   -> 103
+0086 OP_JUMP_IF_FALSE 86   -> 96
            stackframe: [ <closure <script>> ][ 2 ][ 2 ][ true ]
-0096   OP_POP
+0089   OP_POP
            stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0097   OP_BREAK
+0090 OP_BREAK         90   -> 117
            stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0122   OP_POP
+0117   OP_POP
            stackframe: [ <closure <script>> ][ 2 ]
-0123 OP_LOOP          123  -> 18
+0118 OP_LOOP          118  -> 15
            stackframe: [ <closure <script>> ][ 2 ]
-0018   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0020   OP_CONSTANT [4] 1
-           stackframe: [ <closure <script>> ][ 2 ][ 2 ][ 1 ]
-0022   OP_ADD
-           stackframe: [ <closure <script>> ][ 2 ][ 3 ]
-0023   OP_SET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 3 ][ 3 ]
-0025   OP_POP
-           stackframe: [ <closure <script>> ][ 3 ]
-0026 OP_LOOP          26   -> 6
+0015   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
            stackframe: [ <closure <script>> ][ 3 ]
-0006   OP_GET_LOCAL [1] 
-           stackframe: [ <closure <script>> ][ 3 ][ 3 ]
-0008   OP_CONSTANT [3] 3
-           stackframe: [ <closure <script>> ][ 3 ][ 3 ][ 3 ]
-0010   OP_LESS
-           stackframe: [ <closure <script>> ][ 3 ][ false ]
-0011 OP_JUMP_IF_FALSE 11   -> 126
-           stackframe: [ <closure <script>> ][ 3 ][ false ]
-0126   OP_POP
+0007 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 3 7    -> 121
            stackframe: [ <closure <script>> ][ 3 ]
-0127   OP_POP
+0121   OP_POP
            stackframe: [ <closure <script>> ]
-0128   OP_CONSTANT [16] 0
+0122   OP_CONSTANT [11] 0
            stackframe: [ <closure <script>> ][ 0 ]
-0130   OP_DEFINE_GLOBAL [15] "k"
-allocate: 56
+0124   OP_DEFINE_GLOBAL [10] 
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 0 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 0 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 0 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD
            stackframe: [ <closure <script>> ][ 1 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 0 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 0 ][ 0 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 0 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ true ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ true ]
-0161   OP_POP
+0159   OP_POP
            stackframe: [ <closure <script>> ]
-0162   OP_GET_GLOBAL [26] "k"
+0160   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 0 ]
-0164   OP_CONSTANT [27] 1
+0163   OP_CONSTANT [17] 1
            stackframe: [ <closure <script>> ][ 0 ][ 1 ]
-0166   OP_ADD
+0165   OP_ADD
            stackframe: [ <closure <script>> ][ 1 ]
-0167   OP_SET_GLOBAL [25] "k"
+0166   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 1 ]
 0169   OP_POP
            stackframe: [ <closure <script>> ]
-0170   OP_CONTINUE
+0170 OP_CONTINUE      170  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 1 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 1 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 1 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 2 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 1 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 1 ][ 1 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 1 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ false ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ false ]
 0176   OP_POP
            stackframe: [ <closure <script>> ]
-0177   OP_GET_GLOBAL [28] "k"
+0177   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 1 ]
-0179   OP_CONSTANT [29] 7
+0180   OP_CONSTANT [18] 7
            stackframe: [ <closure <script>> ][ 1 ][ 7 ]
-0181   OP_GREATER
+0182   OP_GREATER
            stackframe: [ <closure <script>> ][ false ]
-0182 OP_JUMP_IF_FALSE 182  -> 192
+0183 OP_JUMP_IF_FALSE 183  -> 193
            stackframe: [ <closure <script>> ][ false ]
-0192   OP_POP
+0193   OP_POP
            stackframe: [ <closure <script>> ]
-0193   OP_GET_GLOBAL [30] "k"
+0194   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 1 ]
-0195   OP_PRINT
+0197   OP_PRINT
 1
            stackframe: [ <closure <script>> ]
-0196   OP_GET_GLOBAL [32] "k"
+0198   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 1 ]
-0198   OP_CONSTANT [33] 1
+0201   OP_CONSTANT [19] 1
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0200   OP_ADD
+0203   OP_ADD
            stackframe: [ <closure <script>> ][ 2 ]
-0201   OP_SET_GLOBAL [31] "k"
+0204   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 2 ]
-0203   OP_POP
+0207   OP_POP
            stackframe: [ <closure <script>> ]
-0204 OP_LOOP          204  -> 132
+0208 OP_LOOP          208  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 2 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 2 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 2 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 3 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 3 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 1 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 1 ][ 1 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 0 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ true ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ true ]
-0161   OP_POP
+0159   OP_POP
            stackframe: [ <closure <script>> ]
-0162   OP_GET_GLOBAL [26] "k"
+0160   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 2 ]
-0164   OP_CONSTANT [27] 1
+0163   OP_CONSTANT [17] 1
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0166   OP_ADD
+0165   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 3 ]
-0167   OP_SET_GLOBAL [25] "k"
+0166   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 3 ]
 0169   OP_POP
            stackframe: [ <closure <script>> ]
-0170   OP_CONTINUE
+0170 OP_CONTINUE      170  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 3 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 3 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 3 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 3 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 4 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 4 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 2 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 2 ][ 3 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 2 ][ 3 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 2 ][ 1 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 1 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ false ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ false ]
 0176   OP_POP
            stackframe: [ <closure <script>> ]
-0177   OP_GET_GLOBAL [28] "k"
+0177   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 3 ]
-0179   OP_CONSTANT [29] 7
+0180   OP_CONSTANT [18] 7
            stackframe: [ <closure <script>> ][ 3 ][ 7 ]
-0181   OP_GREATER
+0182   OP_GREATER
            stackframe: [ <closure <script>> ][ false ]
-0182 OP_JUMP_IF_FALSE 182  -> 192
+0183 OP_JUMP_IF_FALSE 183  -> 193
            stackframe: [ <closure <script>> ][ false ]
-0192   OP_POP
+0193   OP_POP
            stackframe: [ <closure <script>> ]
-0193   OP_GET_GLOBAL [30] "k"
+0194   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 3 ]
-0195   OP_PRINT
+0197   OP_PRINT
 3
            stackframe: [ <closure <script>> ]
-0196   OP_GET_GLOBAL [32] "k"
+0198   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 3 ]
-0198   OP_CONSTANT [33] 1
+0201   OP_CONSTANT [19] 1
            stackframe: [ <closure <script>> ][ 3 ][ 1 ]
-0200   OP_ADD
+0203   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 4 ]
-0201   OP_SET_GLOBAL [31] "k"
+0204   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 4 ]
-0203   OP_POP
+0207   OP_POP
            stackframe: [ <closure <script>> ]
-0204 OP_LOOP          204  -> 132
+0208 OP_LOOP          208  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 4 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 4 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 4 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 4 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 5 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 5 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 2 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 2 ][ 4 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 2 ][ 4 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 2 ][ 2 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 0 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ true ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ true ]
-0161   OP_POP
+0159   OP_POP
            stackframe: [ <closure <script>> ]
-0162   OP_GET_GLOBAL [26] "k"
+0160   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 4 ]
-0164   OP_CONSTANT [27] 1
+0163   OP_CONSTANT [17] 1
            stackframe: [ <closure <script>> ][ 4 ][ 1 ]
-0166   OP_ADD
+0165   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 5 ]
-0167   OP_SET_GLOBAL [25] "k"
+0166   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 5 ]
 0169   OP_POP
            stackframe: [ <closure <script>> ]
-0170   OP_CONTINUE
+0170 OP_CONTINUE      170  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 5 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 5 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 5 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 5 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 6 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 6 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 3 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 3 ][ 5 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 3 ][ 5 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 3 ][ 2 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 1 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ false ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ false ]
 0176   OP_POP
            stackframe: [ <closure <script>> ]
-0177   OP_GET_GLOBAL [28] "k"
+0177   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 5 ]
-0179   OP_CONSTANT [29] 7
+0180   OP_CONSTANT [18] 7
            stackframe: [ <closure <script>> ][ 5 ][ 7 ]
-0181   OP_GREATER
+0182   OP_GREATER
            stackframe: [ <closure <script>> ][ false ]
-0182 OP_JUMP_IF_FALSE 182  -> 192
+0183 OP_JUMP_IF_FALSE 183  -> 193
            stackframe: [ <closure <script>> ][ false ]
-0192   OP_POP
+0193   OP_POP
            stackframe: [ <closure <script>> ]
-0193   OP_GET_GLOBAL [30] "k"
+0194   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 5 ]
-0195   OP_PRINT
+0197   OP_PRINT
 5
            stackframe: [ <closure <script>> ]
-0196   OP_GET_GLOBAL [32] "k"
+0198   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 5 ]
-0198   OP_CONSTANT [33] 1
+0201   OP_CONSTANT [19] 1
            stackframe: [ <closure <script>> ][ 5 ][ 1 ]
-0200   OP_ADD
+0203   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 6 ]
-0201   OP_SET_GLOBAL [31] "k"
+0204   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 6 ]
-0203   OP_POP
+0207   OP_POP
            stackframe: [ <closure <script>> ]
-0204 OP_LOOP          204  -> 132
+0208 OP_LOOP          208  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 6 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 6 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 6 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 6 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 7 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 7 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 3 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 3 ][ 6 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 3 ][ 6 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 3 ][ 3 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 0 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ true ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ true ]
-0161   OP_POP
+0159   OP_POP
            stackframe: [ <closure <script>> ]
-0162   OP_GET_GLOBAL [26] "k"
+0160   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 6 ]
-0164   OP_CONSTANT [27] 1
+0163   OP_CONSTANT [17] 1
            stackframe: [ <closure <script>> ][ 6 ][ 1 ]
-0166   OP_ADD
+0165   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 7 ]
-0167   OP_SET_GLOBAL [25] "k"
+0166   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 7 ]
 0169   OP_POP
            stackframe: [ <closure <script>> ]
-0170   OP_CONTINUE
+0170 OP_CONTINUE      170  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 7 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 7 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 7 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 7 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 8 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 8 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 4 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 4 ][ 7 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 4 ][ 7 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 4 ][ 3 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 1 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ false ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ false ]
 0176   OP_POP
            stackframe: [ <closure <script>> ]
-0177   OP_GET_GLOBAL [28] "k"
+0177   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 7 ]
-0179   OP_CONSTANT [29] 7
+0180   OP_CONSTANT [18] 7
            stackframe: [ <closure <script>> ][ 7 ][ 7 ]
-0181   OP_GREATER
+0182   OP_GREATER
            stackframe: [ <closure <script>> ][ false ]
-0182 OP_JUMP_IF_FALSE 182  -> 192
+0183 OP_JUMP_IF_FALSE 183  -> 193
            stackframe: [ <closure <script>> ][ false ]
-0192   OP_POP
+0193   OP_POP
            stackframe: [ <closure <script>> ]
-0193   OP_GET_GLOBAL [30] "k"
+0194   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 7 ]
-0195   OP_PRINT
+0197   OP_PRINT
 7
            stackframe: [ <closure <script>> ]
-0196   OP_GET_GLOBAL [32] "k"
+0198   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 7 ]
-0198   OP_CONSTANT [33] 1
+0201   OP_CONSTANT [19] 1
            stackframe: [ <closure <script>> ][ 7 ][ 1 ]
-0200   OP_ADD
+0203   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 8 ]
-0201   OP_SET_GLOBAL [31] "k"
+0204   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 8 ]
-0203   OP_POP
+0207   OP_POP
            stackframe: [ <closure <script>> ]
-0204 OP_LOOP          204  -> 132
+0208 OP_LOOP          208  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 8 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 8 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 8 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 8 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 9 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 9 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 4 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 4 ][ 8 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 4 ][ 8 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 4 ][ 4 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 0 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 0 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ true ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ true ]
-0161   OP_POP
+0159   OP_POP
            stackframe: [ <closure <script>> ]
-0162   OP_GET_GLOBAL [26] "k"
+0160   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 8 ]
-0164   OP_CONSTANT [27] 1
+0163   OP_CONSTANT [17] 1
            stackframe: [ <closure <script>> ][ 8 ][ 1 ]
-0166   OP_ADD
+0165   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 9 ]
-0167   OP_SET_GLOBAL [25] "k"
+0166   OP_SET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 9 ]
 0169   OP_POP
            stackframe: [ <closure <script>> ]
-0170   OP_CONTINUE
+0170 OP_CONTINUE      170  -> 127
            stackframe: [ <closure <script>> ]
-0132   OP_GET_GLOBAL [17] "k"
+0127   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 9 ]
-0134   OP_CONSTANT [18] 10
+0130   OP_CONSTANT [12] 10
            stackframe: [ <closure <script>> ][ 9 ][ 10 ]
-0136   OP_LESS
+0132   OP_LESS_INT
            stackframe: [ <closure <script>> ][ true ]
-0137 OP_JUMP_IF_FALSE 137  -> 207
+0133 OP_JUMP_IF_FALSE 133  -> 211
            stackframe: [ <closure <script>> ][ true ]
-0140   OP_POP
+0136   OP_POP
            stackframe: [ <closure <script>> ]
-0141   OP_GET_GLOBAL [19] "k"
+0137   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 9 ]
-0143   OP_CONSTANT [20] 1
+0140   OP_CONSTANT [13] 1
            stackframe: [ <closure <script>> ][ 9 ][ 1 ]
-0145   OP_ADD
+0142   OP_ADD_INT
            stackframe: [ <closure <script>> ][ 10 ]
-0146   OP_CONSTANT [21] 2
+0143   OP_CONSTANT [14] 2
            stackframe: [ <closure <script>> ][ 10 ][ 2 ]
-0148   OP_DIV
+0145   OP_DIV
            stackframe: [ <closure <script>> ][ 5 ]
-0149   OP_GET_GLOBAL [22] "k"
+0146   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 5 ][ 9 ]
-0151   OP_CONSTANT [23] 2
+0149   OP_CONSTANT [15] 2
            stackframe: [ <closure <script>> ][ 5 ][ 9 ][ 2 ]
-0153   OP_DIV
+0151   OP_DIV
            stackframe: [ <closure <script>> ][ 5 ][ 4 ]
-0154   OP_SUB
+0152   OP_SUB
            stackframe: [ <closure <script>> ][ 1 ]
-0155   OP_CONSTANT [24] 0
+0153   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ 1 ][ 0 ]
-0157   OP_EQUAL
+0155   OP_EQUAL
            stackframe: [ <closure <script>> ][ false ]
-0158 OP_JUMP_IF_FALSE 158  -> 176
+0156 OP_JUMP_IF_FALSE 156  -> 176
            stackframe: [ <closure <script>> ][ false ]
 0176   OP_POP
            stackframe: [ <closure <script>> ]
-0177   OP_GET_GLOBAL [28] "k"
+0177   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ 9 ]
-0179   OP_CONSTANT [29] 7
+0180   OP_CONSTANT [18] 7
            stackframe: [ <closure <script>> ][ 9 ][ 7 ]
-0181   OP_GREATER
+0182   OP_GREATER
            stackframe: [ <closure <script>> ][ true ]
-0182 OP_JUMP_IF_FALSE 182  -> 192
+0183 OP_JUMP_IF_FALSE 183  -> 193
            stackframe: [ <closure <script>> ][ true ]
-0185   OP_POP
+0186   OP_POP
            stackframe: [ <closure <script>> ]
-0186   OP_BREAK
+0187 OP_BREAK         187  -> 212
            stackframe: [ <closure <script>> ]
-0208   OP_GET_GLOBAL [34] "sum"
+0212   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 4 ]
-0210   OP_CONSTANT [35] 5
+0215   OP_CONSTANT [20] 5
            stackframe: [ <closure <script>> ][ 4 ][ 5 ]
-0212   OP_GREATER
+0217   OP_GREATER
            stackframe: [ <closure <script>> ][ false ]
-0213 OP_JUMP_IF_FALSE 213  -> 223
+0218 OP_JUMP_IF_FALSE 218  -> 228
            stackframe: [ <closure <script>> ][ false ]
-0223   OP_POP
+0228   OP_POP
            stackframe: [ <closure <script>> ]
-0224   OP_GET_GLOBAL [37] "sum"
+0229   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ 4 ]
-0226   OP_CONSTANT [38] 5
+0232   OP_CONSTANT [22] 5
            stackframe: [ <closure <script>> ][ 4 ][ 5 ]
-0228   OP_EQUAL
+0234   OP_EQUAL
            stackframe: [ <closure <script>> ][ false ]
-0229 OP_JUMP_IF_FALSE 229  -> 239
+0235 OP_JUMP_IF_FALSE 235  -> 245
            stackframe: [ <closure <script>> ][ false ]
-0239   OP_POP
+0245   OP_POP
            stackframe: [ <closure <script>> ]
-0240   OP_CONSTANT [40] "Sum is less than 5"
+0246   OP_CONSTANT [24] "Sum is less than 5"
            stackframe: [ <closure <script>> ][ "Sum is less than 5" ]
-0242   OP_PRINT
+0248   OP_PRINT
 "Sum is less than 5"
            stackframe: [ <closure <script>> ]
-0243   OP_NIL
+0249 OP_BREAK         249  -> 255
+           stackframe: [ <closure <script>> ]
+0255   OP_CONSTANT [25] "after for"
+           stackframe: [ <closure <script>> ][ "after for" ]
+0257   OP_PRINT
+"after for"
+           stackframe: [ <closure <script>> ]
+0258   OP_CONSTANT [47] 11
+           stackframe: [ <closure <script>> ][ 11 ]
+0260   OP_PRINT
+11
+           stackframe: [ <closure <script>> ]
+0261   OP_FALSE
+           stackframe: [ <closure <script>> ][ false ]
+0262   OP_PRINT
+false
+           stackframe: [ <closure <script>> ]
+0263   OP_FALSE
+           stackframe: [ <closure <script>> ][ false ]
+0264   OP_TRUE
+           stackframe: [ <closure <script>> ][ false ][ true ]
+0265   OP_NOT_EQUAL
+           stackframe: [ <closure <script>> ][ true ]
+0266   OP_PRINT
+true
+           stackframe: [ <closure <script>> ]
+0267   OP_CLOSURE [37] <fn "countdown">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ]
+0269   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0272   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ]
+0275   OP_CONSTANT [38] 4
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ]
+0277   OP_CONSTANT [39] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ]
+0279   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 4 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 4 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 4 ]
+0021 OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL [3] [1] 21   -> 29
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 4 ]
+0026 OP_CONTINUE      26   -> 10
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 4 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 4 ][ 3 ]
+0015   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ][ 3 ]
+0017   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ]
+0018 OP_LOOP          18   -> 2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ]
+0021 OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL [3] [1] 21   -> 29
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ]
+0029 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [3] 0 29   -> 40
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ]
+0034   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ][ 3 ]
+0036   OP_PRINT
+3
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ]
+0037 OP_LOOP          37   -> 10
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 3 ][ 2 ]
+0015   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ][ 2 ]
+0017   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ]
+0018 OP_LOOP          18   -> 2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ]
+0021 OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL [3] [1] 21   -> 29
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ]
+0029 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [3] 0 29   -> 40
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ]
+0034   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ][ 2 ]
+0036   OP_PRINT
+2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ]
+0037 OP_LOOP          37   -> 10
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 2 ][ 1 ]
+0015   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ][ 1 ]
+0017   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ]
+0018 OP_LOOP          18   -> 2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ]
+0021 OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL [3] [1] 21   -> 29
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ]
+0029 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [3] 0 29   -> 40
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ]
+0034   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ][ 1 ]
+0036   OP_PRINT
+1
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ]
+0037 OP_LOOP          37   -> 10
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 1 ][ 0 ]
+0015   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ][ 0 ]
+0017   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0018 OP_LOOP          18   -> 2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0021 OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL [3] [1] 21   -> 29
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0029 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [3] 0 29   -> 40
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0040   OP_CONSTANT [2] "zero"
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ][ "zero" ]
+0042   OP_PRINT
+"zero"
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0043 OP_LOOP          43   -> 10
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ][ -1 ]
+0015   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ -1 ][ -1 ]
+0017   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ -1 ]
+0018 OP_LOOP          18   -> 2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ -1 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ -1 ]
+0046   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ]
+0047   OP_CONSTANT [3] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0049 OP_JUMP_IF_EQUAL_LOCAL_LOCAL [3] [2] 49   -> 65
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ]
+0065   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 4 ][ 0 ][ 0 ][ 0 ]
+0067   OP_RETURN
+           stackframe: [ <closure <script>> ][ 0 ]
+0281   OP_PRINT
+0
+           stackframe: [ <closure <script>> ]
+0282   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ]
+0285   OP_CONSTANT [40] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ]
+0287   OP_CONSTANT [41] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ]
+0289   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 3 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 3 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 3 ]
+0021 OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL [3] [1] 21   -> 29
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 3 ]
+0026 OP_CONTINUE      26   -> 10
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 3 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 3 ][ 2 ]
+0015   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ][ 2 ]
+0017   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0018 OP_LOOP          18   -> 2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0021 OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL [3] [1] 21   -> 29
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0029 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [3] 0 29   -> 40
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0034   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ][ 2 ]
+0036   OP_PRINT
+2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0037 OP_LOOP          37   -> 10
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ][ 1 ]
+0015   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 1 ][ 1 ]
+0017   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 1 ]
+0018 OP_LOOP          18   -> 2
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 1 ]
+0002 OP_JUMP_IF_LESS_LOCAL_LOCAL [3] [2] 2    -> 46
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 1 ]
+0046   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ]
+0047   OP_CONSTANT [3] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 0 ]
+0049 OP_JUMP_IF_EQUAL_LOCAL_LOCAL [3] [2] 49   -> 65
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 0 ]
+0054   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 1 ]
+0049 OP_JUMP_IF_EQUAL_LOCAL_LOCAL [3] [2] 49   -> 65
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 1 ]
+0054   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0049 OP_JUMP_IF_EQUAL_LOCAL_LOCAL [3] [2] 49   -> 65
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ]
+0065   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "countdown">> ][ 3 ][ 2 ][ 2 ][ 2 ]
+0067   OP_RETURN
+           stackframe: [ <closure <script>> ][ 2 ]
+0291   OP_PRINT
+2
+           stackframe: [ <closure <script>> ]
+0292   OP_CLOSURE [42] <fn "repeat">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ]
+0294   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0297   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ]
+0300   OP_CONSTANT [43] "ab"
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ]
+0302   OP_CONSTANT [44] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ]
+0304   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ]
+0000   OP_CONSTANT [0] ""
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "" ]
+0002   OP_CONSTANT [1] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "" ][ 0 ]
+0004 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [4] [2] 4    -> 34
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "" ][ 0 ]
+0009 OP_JUMP          9    -> 23
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "" ][ 0 ]
+0023   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "" ][ 0 ][ "" ]
+0025   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "" ][ 0 ][ "" ][ "ab" ]
+0027   OP_ADD
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "" ][ 0 ][ "ab" ]
+0028   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 0 ][ "ab" ]
+0030   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 0 ]
+0031 OP_LOOP          31   -> 12
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 0 ]
+0012   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 1 ]
+0004 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [4] [2] 4    -> 34
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 1 ]
+0009 OP_JUMP          9    -> 23
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 1 ]
+0023   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 1 ][ "ab" ]
+0025   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 1 ][ "ab" ][ "ab" ]
+0027   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ab" ][ 1 ][ "abab" ]
+0028   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 1 ][ "abab" ]
+0030   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 1 ]
+0031 OP_LOOP          31   -> 12
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 1 ]
+0012   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 2 ]
+0004 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [4] [2] 4    -> 34
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 2 ]
+0009 OP_JUMP          9    -> 23
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 2 ]
+0023   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 2 ][ "abab" ]
+0025   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 2 ][ "abab" ][ "ab" ]
+0027   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "abab" ][ 2 ][ "ababab" ]
+0028   OP_SET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 2 ][ "ababab" ]
+0030   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 2 ]
+0031 OP_LOOP          31   -> 12
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 2 ]
+0012   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 56 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ]
+0004 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [4] [2] 4    -> 34
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ]
+0034   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ]
+0035   OP_CONSTANT [3] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ]
+0037   OP_CONSTANT [4] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 0 ]
+0039 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [5] [2] 39   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 0 ]
+0044 OP_JUMP          44   -> 58
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 0 ]
+0058   OP_GET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 0 ][ 0 ]
+0060   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 0 ][ 0 ]
+0063   OP_SET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 0 ][ 0 ]
+0065   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 0 ]
+0066 OP_LOOP          66   -> 47
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 0 ]
+0047   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 1 ]
+0039 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [5] [2] 39   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 1 ]
+0044 OP_JUMP          44   -> 58
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 1 ]
+0058   OP_GET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 1 ][ 0 ]
+0060   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 0 ][ 1 ][ 1 ]
+0063   OP_SET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 1 ][ 1 ][ 1 ]
+0065   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 1 ][ 1 ]
+0066 OP_LOOP          66   -> 47
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 1 ][ 1 ]
+0047   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 1 ][ 2 ]
+0039 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [5] [2] 39   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 1 ][ 2 ]
+0044 OP_JUMP          44   -> 58
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 1 ][ 2 ]
+0058   OP_GET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 1 ][ 2 ][ 1 ]
+0060   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 1 ][ 2 ][ 3 ]
+0063   OP_SET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ 2 ][ 3 ]
+0065   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ 2 ]
+0066 OP_LOOP          66   -> 47
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ 2 ]
+0047   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ 3 ]
+0039 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [5] [2] 39   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ 3 ]
+0069   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ "ababab" ]
+0072   OP_CONSTANT [6] " "
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ "ababab" ][ " " ]
+0074   OP_ADD
+allocate: 56
+allocate: 512
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ "ababab " ]
+0075   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ "ababab " ][ 3 ]
+0077   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "repeat">> ][ "ab" ][ 3 ][ "ababab" ][ 3 ][ "ababab 3" ]
+0078   OP_RETURN
+           stackframe: [ <closure <script>> ][ "ababab 3" ]
+0306   OP_PRINT
+"ababab 3"
+           stackframe: [ <closure <script>> ]
+0307   OP_NIL
            stackframe: [ <closure <script>> ][ nil ]
-0244   OP_RETURN
+0308   OP_RETURN
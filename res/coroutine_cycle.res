@@ -0,0 +1,2200 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 56
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 256
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 12
+allocate: 48
+=== "second"===
+allocate: 16
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 768
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 128
+allocate: 56
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 47
+allocate: 188
+=== "first"===
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 64
+allocate: 45
+allocate: 180
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0001   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0004   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0005   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0008   OP_CLOSURE [0] <fn "second">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "second">> ]
+0010   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0013   OP_CLOSURE [1] <fn "first">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "first">> ]
+0015   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0018   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <closure <fn "first">> ]
+0021   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "first">>> ]
+0023   OP_SET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "first">>> ]
+0026   OP_POP
+           stackframe: [ <closure <script>> ]
+0027   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "second">> ]
+0030   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "second">>> ]
+0032   OP_SET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "second">>> ]
+0035   OP_POP
+           stackframe: [ <closure <script>> ]
+0036   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "first">>> ]
+0039   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0000   OP_CONSTANT [0] "a resumes b"
+           stackframe: [ nil ][ "a resumes b" ]
+0002   OP_PRINT
+"a resumes b"
+           stackframe: [ nil ]
+0003   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ <coroutine <closure <fn "second">>> ]
+0006   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0000   OP_CONSTANT [0] "b resumes a"
+           stackframe: [ nil ][ "b resumes a" ]
+0002   OP_PRINT
+"b resumes a"
+           stackframe: [ nil ]
+0003   OP_GET_GLOBAL [9] 
+           stackframe: [ nil ][ <coroutine <closure <fn "first">>> ]
+0006   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0007   OP_CONSTANT [1] "b end"
+           stackframe: [ nil ][ "b end" ]
+0009   OP_PRINT
+"b end"
+           stackframe: [ nil ]
+0010   OP_NIL
+           stackframe: [ nil ][ nil ]
+0011   OP_RETURN
+           stackframe: [ nil ]
+0007   OP_CONSTANT [1] ""
+           stackframe: [ nil ][ "" ]
+0009   OP_CONSTANT [2] 0
+           stackframe: [ nil ][ "" ][ 0 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "" ][ 0 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "" ][ 0 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "" ][ 0 ][ "" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "" ][ 0 ][ "" ][ "x" ]
+0034   OP_ADD
+           stackframe: [ nil ][ "" ][ 0 ][ "x" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "x" ][ 0 ][ "x" ]
+0037   OP_POP
+           stackframe: [ nil ][ "x" ][ 0 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "x" ][ 0 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "x" ][ 1 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "x" ][ 1 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "x" ][ 1 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "x" ][ 1 ][ "x" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "x" ][ 1 ][ "x" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "x" ][ 1 ][ "xx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xx" ][ 1 ][ "xx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xx" ][ 1 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xx" ][ 1 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xx" ][ 2 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xx" ][ 2 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xx" ][ 2 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xx" ][ 2 ][ "xx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xx" ][ 2 ][ "xx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xx" ][ 2 ][ "xxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxx" ][ 2 ][ "xxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxx" ][ 2 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxx" ][ 2 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxx" ][ 3 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxx" ][ 3 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxx" ][ 3 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxx" ][ 3 ][ "xxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxx" ][ 3 ][ "xxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxx" ][ 3 ][ "xxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxx" ][ 3 ][ "xxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxx" ][ 3 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxx" ][ 3 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 112 bytes
+           stackframe: [ nil ][ "xxxx" ][ 4 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxx" ][ 4 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxx" ][ 4 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxx" ][ 4 ][ "xxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxx" ][ 4 ][ "xxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 512
+           stackframe: [ nil ][ "xxxx" ][ 4 ][ "xxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxx" ][ 4 ][ "xxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxx" ][ 4 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxx" ][ 4 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxx" ][ 5 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxx" ][ 5 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxx" ][ 5 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxx" ][ 5 ][ "xxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxx" ][ 5 ][ "xxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxx" ][ 5 ][ "xxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxx" ][ 5 ][ "xxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxx" ][ 5 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxx" ][ 5 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxx" ][ 6 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxx" ][ 6 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxx" ][ 6 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxx" ][ 6 ][ "xxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxx" ][ 6 ][ "xxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxxx" ][ 6 ][ "xxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxx" ][ 6 ][ "xxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxx" ][ 6 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxx" ][ 6 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxx" ][ 7 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxx" ][ 7 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxx" ][ 7 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxx" ][ 7 ][ "xxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxx" ][ 7 ][ "xxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxxxx" ][ 7 ][ "xxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxx" ][ 7 ][ "xxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxx" ][ 7 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxx" ][ 7 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxx" ][ 8 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxx" ][ 8 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxx" ][ 8 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxx" ][ 8 ][ "xxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxx" ][ 8 ][ "xxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxxxxx" ][ 8 ][ "xxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 8 ][ "xxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 8 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 8 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 9 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 9 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 9 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 9 ][ "xxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 9 ][ "xxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+gc collect 280 bytes
+           stackframe: [ nil ][ "xxxxxxxxx" ][ 9 ][ "xxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 9 ][ "xxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 9 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 9 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 10 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 10 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 10 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 10 ][ "xxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 10 ][ "xxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxxxxxxx" ][ 10 ][ "xxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 10 ][ "xxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 10 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 10 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 11 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 11 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 11 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 11 ][ "xxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 11 ][ "xxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxxxxxxxx" ][ 11 ][ "xxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 11 ][ "xxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 11 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 11 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 12 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 12 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 12 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 12 ][ "xxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 12 ][ "xxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxxxxxxxxx" ][ 12 ][ "xxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 12 ][ "xxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 12 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 12 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 13 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 13 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 13 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 13 ][ "xxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 13 ][ "xxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxxxxxxxxxx" ][ 13 ][ "xxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 13 ][ "xxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 13 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 13 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 14 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 14 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 14 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 14 ][ "xxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 14 ][ "xxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxxxxxxxxxxxx" ][ 14 ][ "xxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 14 ][ "xxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 14 ]
+0038 OP_LOOP          38   -> 19
+gc collect 336 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 14 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 15 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 15 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 15 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 15 ][ "xxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 15 ][ "xxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxx" ][ 15 ][ "xxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 15 ][ "xxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 15 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 15 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 16 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 16 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 16 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 16 ][ "xxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 16 ][ "xxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 16 ][ "xxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 16 ][ "xxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 16 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 16 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 17 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 17 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 17 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 17 ][ "xxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 17 ][ "xxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxx" ][ 17 ][ "xxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 17 ][ "xxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 17 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 17 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 18 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 18 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 18 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 18 ][ "xxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 18 ][ "xxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxx" ][ 18 ][ "xxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 18 ][ "xxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 18 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 18 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 19 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 19 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 19 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 19 ][ "xxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 19 ][ "xxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxx" ][ 19 ][ "xxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 19 ][ "xxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 19 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 19 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 404 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 20 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 20 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 20 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 20 ][ "xxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 20 ][ "xxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxx" ][ 20 ][ "xxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 20 ][ "xxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 20 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 20 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 21 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 21 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 21 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 21 ][ "xxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 21 ][ "xxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxx" ][ 21 ][ "xxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 21 ][ "xxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 21 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 21 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 22 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 22 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 22 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 22 ][ "xxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 22 ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxx" ][ 22 ][ "xxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 22 ][ "xxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 22 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 22 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ][ "xxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 23 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 24 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+gc collect 435 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 25 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 26 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 27 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 28 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 29 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 32
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ]
+0038 OP_LOOP          38   -> 19
+gc collect 522 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 30 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 33
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 31 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 34
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 32 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 35
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 33 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 36
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 34 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 37
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 35 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 450 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 38
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 36 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 39
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 37 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 40
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 38 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 39 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 42
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 40 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 43
+gc collect 475 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 41 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 44
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 42 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 45
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 43 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 46
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 44 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 47
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 45 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 48
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ]
+0038 OP_LOOP          38   -> 19
+gc collect 603 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 46 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 49
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 47 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 50
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 48 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 51
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 49 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 52
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 50 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 53
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 51 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 530 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 54
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 52 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 55
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 53 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 56
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 54 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 57
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 55 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 58
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 56 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 59
+gc collect 555 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 57 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 60
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 58 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 61
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 59 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 62
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 60 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 63
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 61 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 64
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ]
+0038 OP_LOOP          38   -> 19
+gc collect 699 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 62 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 65
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 63 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 66
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 64 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 67
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 65 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 68
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 66 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 69
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 67 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 610 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 70
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 68 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 71
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 69 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 72
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 70 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 73
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 71 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 74
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 72 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 75
+gc collect 635 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 73 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 76
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 74 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 77
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 75 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 78
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 76 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 79
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 77 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 80
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ]
+0038 OP_LOOP          38   -> 19
+gc collect 795 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 78 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 81
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 79 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 82
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 80 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 83
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 81 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 84
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 82 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 85
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 83 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 690 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 86
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 84 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 87
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 85 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 88
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 86 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 89
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 87 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 90
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 88 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 91
+gc collect 715 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 89 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 92
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 90 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 93
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 91 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 94
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 92 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 95
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 93 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 96
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ]
+0038 OP_LOOP          38   -> 19
+gc collect 891 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 94 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 97
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 95 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 98
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 96 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 99
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 97 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 100
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 98 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ]
+0016 OP_JUMP          16   -> 30
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0032   OP_CONSTANT [5] "x"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "x" ]
+0034   OP_ADD_STR
+allocate: 56
+allocate: 101
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0035   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0037   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ]
+0038 OP_LOOP          38   -> 19
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 99 ]
+0019   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 770 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 100 ]
+0011 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [2] 100 11   -> 41
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 100 ]
+0041   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0042   OP_CONSTANT [6] "a end"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ "a end" ]
+0044   OP_PRINT
+"a end"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0045   OP_NIL
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ nil ]
+0046   OP_RETURN
+           stackframe: [ <closure <script>> ]
+0040   OP_CONSTANT [2] "main end"
+           stackframe: [ <closure <script>> ][ "main end" ]
+0042   OP_PRINT
+"main end"
+           stackframe: [ <closure <script>> ]
+0043   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0044   OP_RETURN
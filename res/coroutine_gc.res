@@ -0,0 +1,1610 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 32
+allocate: 4
+allocate: 16
+allocate: 64
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 256
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 128
+allocate: 512
+allocate: 70
+allocate: 280
+=== "grow"===
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 56
+allocate: 32
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 64
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 21
+allocate: 84
+=== "middle"===
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 50
+allocate: 200
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CLOSURE [0] <fn "grow">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_CLOSURE [1] <fn "middle">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "middle">> ]
+0007   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0010   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ]
+0013   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ]
+0000   OP_CONSTANT [0] "x"
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ]
+0002   OP_CONSTANT [1] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ]
+0004   OP_CONSTANT [2] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ 0 ][ 24 ]
+0010   OP_LESS
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ true ]
+0014   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 56
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ {"bytes" : 4745, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 952, "count" : 17}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ {"bytes" : 4745, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 952, "count" : 17}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ 4745 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ 4745 ][ 0 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ true ]
+0029   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 512
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ {"bytes" : 7009, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1344, "count" : 24}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ {"bytes" : 7009, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1344, "count" : 24}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 0 ][ 0 ][ 7009 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 7009 ][ 0 ][ 7009 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 7009 ][ 0 ][ "x" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 7009 ][ 0 ][ "x" ][ "x" ]
+0059   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "x" ][ 7009 ][ 0 ][ "xx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 0 ][ "xx" ]
+0062   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 0 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 0 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ 1 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ true ]
+0014   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ {"bytes" : 9569, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 4064, "count" : 13}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1456, "count" : 26}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ {"bytes" : 9569, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 4064, "count" : 13}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1456, "count" : 26}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ 9569 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ 9569 ][ 7009 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ true ]
+0029   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ {"bytes" : 11761, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 6256, "count" : 20}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1456, "count" : 26}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ {"bytes" : 11761, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 6256, "count" : 20}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1456, "count" : 26}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 7009 ][ 1 ][ 11761 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 11761 ][ 1 ][ 11761 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 11761 ][ 1 ][ "xx" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 11761 ][ 1 ][ "xx" ][ "xx" ]
+0059   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xx" ][ 11761 ][ 1 ][ "xxxx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 1 ][ "xxxx" ]
+0062   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 1 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 1 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ 2 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ true ]
+0014   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ {"bytes" : 14009, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 8448, "count" : 27}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1512, "count" : 27}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ {"bytes" : 14009, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 8448, "count" : 27}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1512, "count" : 27}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ 14009 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ 14009 ][ 11761 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ true ]
+0029   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ {"bytes" : 16201, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 10640, "count" : 34}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1512, "count" : 27}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ {"bytes" : 16201, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 10640, "count" : 34}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1512, "count" : 27}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 11761 ][ 2 ][ 16201 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 16201 ][ 2 ][ 16201 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 16201 ][ 2 ][ "xxxx" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 16201 ][ 2 ][ "xxxx" ][ "xxxx" ]
+0059   OP_ADD_STR
+allocate: 56
+gc collect 13336 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxx" ][ 16201 ][ 2 ][ "xxxxxxxx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 2 ][ "xxxxxxxx" ]
+0062   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 2 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 2 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ 3 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ true ]
+0014   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 56
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ {"bytes" : 5113, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 10082, "string" : {"bytes" : 1064, "count" : 19}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ {"bytes" : 5113, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1481, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 10082, "string" : {"bytes" : 1064, "count" : 19}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ 5113 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ 5113 ][ 16201 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ false ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ 3 ][ false ]
+0066   OP_POPN size: 2
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ]
+0068   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "grow">> ][ "xxxxxxxx" ][ 16201 ][ nil ]
+0069   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0015   OP_POP
+           stackframe: [ <closure <script>> ]
+0016   OP_CONSTANT [2] "hello"
+           stackframe: [ <closure <script>> ][ "hello" ]
+0018   OP_CONSTANT [3] " world "
+           stackframe: [ <closure <script>> ][ "hello" ][ " world " ]
+0020   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ "hello world " ]
+0021   OP_CONSTANT [4] 1
+           stackframe: [ <closure <script>> ][ "hello world " ][ 1 ]
+0023   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ "hello world 1" ]
+0024   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <closure <fn "grow">> ]
+0027   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ]
+0029   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ][ <coroutine <closure <fn "grow">>> ]
+0031   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0000   OP_CONSTANT [0] "x"
+           stackframe: [ nil ][ "x" ]
+0002   OP_CONSTANT [1] 0
+           stackframe: [ nil ][ "x" ][ 0 ]
+0004   OP_CONSTANT [2] 0
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ 0 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+gc collect 2040 bytes
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ {"bytes" : 8369, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 10082, "string" : {"bytes" : 1568, "count" : 28}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ {"bytes" : 8369, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 10082, "string" : {"bytes" : 1568, "count" : 28}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ 8369 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ 8369 ][ 0 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ true ]
+0029   OP_POP
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ {"bytes" : 8577, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 2192, "count" : 7}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17010, "string" : {"bytes" : 1456, "count" : 26}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ {"bytes" : 8577, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 2192, "count" : 7}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17010, "string" : {"bytes" : 1456, "count" : 26}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ 8577 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ nil ][ "x" ][ 8577 ][ 0 ][ 8577 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "x" ][ 8577 ][ 0 ][ "x" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "x" ][ 8577 ][ 0 ][ "x" ][ "x" ]
+0059   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "x" ][ 8577 ][ 0 ][ "xx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 0 ][ "xx" ]
+0062   OP_POP
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 0 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 0 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ 1 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ {"bytes" : 10825, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 4384, "count" : 14}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17010, "string" : {"bytes" : 1512, "count" : 27}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ {"bytes" : 10825, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 4384, "count" : 14}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17010, "string" : {"bytes" : 1512, "count" : 27}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ 10825 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ 10825 ][ 8577 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ true ]
+0029   OP_POP
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ {"bytes" : 13017, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 6576, "count" : 21}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17010, "string" : {"bytes" : 1512, "count" : 27}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ {"bytes" : 13017, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 6576, "count" : 21}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17010, "string" : {"bytes" : 1512, "count" : 27}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xx" ][ 8577 ][ 1 ][ 13017 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ nil ][ "xx" ][ 13017 ][ 1 ][ 13017 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "xx" ][ 13017 ][ 1 ][ "xx" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xx" ][ 13017 ][ 1 ][ "xx" ][ "xx" ]
+0059   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xx" ][ 13017 ][ 1 ][ "xxxx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 1 ][ "xxxx" ]
+0062   OP_POP
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 1 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 1 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 9272 bytes
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ 2 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 56
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ {"bytes" : 5993, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 11842, "string" : {"bytes" : 1064, "count" : 19}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ {"bytes" : 5993, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1481, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 11842, "string" : {"bytes" : 1064, "count" : 19}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ 5993 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ 5993 ][ 13017 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ false ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ 2 ][ false ]
+0066   OP_POPN size: 2
+           stackframe: [ nil ][ "xxxx" ][ 13017 ]
+0068   OP_NIL
+           stackframe: [ nil ][ "xxxx" ][ 13017 ][ nil ]
+0069   OP_RETURN
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ]
+0032   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ][ "hello world 1" ]
+0034   OP_PRINT
+"hello world 1"
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ]
+0035   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ][ <closure <fn "middle">> ]
+0038   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ][ <coroutine <closure <fn "middle">>> ]
+0040   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ][ <coroutine <closure <fn "middle">>> ][ <coroutine <closure <fn "middle">>> ]
+0042   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0000   OP_CONSTANT [0] "middle"
+           stackframe: [ nil ][ "middle" ]
+0002   OP_CONSTANT [1] " kept "
+           stackframe: [ nil ][ "middle" ][ " kept " ]
+0004   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "middle kept " ]
+0005   OP_CONSTANT [2] 2
+           stackframe: [ nil ][ "middle kept " ][ 2 ]
+0007   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "middle kept 2" ]
+0008   OP_GET_GLOBAL [9] 
+           stackframe: [ nil ][ "middle kept 2" ][ <closure <fn "grow">> ]
+0011   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ nil ][ "middle kept 2" ][ <coroutine <closure <fn "grow">>> ]
+0013   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "middle kept 2" ][ <coroutine <closure <fn "grow">>> ][ <coroutine <closure <fn "grow">>> ]
+0015   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0000   OP_CONSTANT [0] "x"
+           stackframe: [ nil ][ "x" ]
+0002   OP_CONSTANT [1] 0
+           stackframe: [ nil ][ "x" ][ 0 ]
+0004   OP_CONSTANT [2] 0
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ 0 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+gc collect 1984 bytes
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ {"bytes" : 10129, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 11842, "string" : {"bytes" : 1568, "count" : 28}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ {"bytes" : 10129, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 11842, "string" : {"bytes" : 1568, "count" : 28}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ 10129 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ 10129 ][ 0 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ true ]
+0029   OP_POP
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ {"bytes" : 10393, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 2192, "count" : 7}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20642, "string" : {"bytes" : 1512, "count" : 27}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ {"bytes" : 10393, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 2192, "count" : 7}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20642, "string" : {"bytes" : 1512, "count" : 27}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ nil ][ "x" ][ 0 ][ 0 ][ 10393 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ nil ][ "x" ][ 10393 ][ 0 ][ 10393 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "x" ][ 10393 ][ 0 ][ "x" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "x" ][ 10393 ][ 0 ][ "x" ][ "x" ]
+0059   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "x" ][ 10393 ][ 0 ][ "xx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 0 ][ "xx" ]
+0062   OP_POP
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 0 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 0 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ 1 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ {"bytes" : 12641, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 4384, "count" : 14}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20642, "string" : {"bytes" : 1568, "count" : 28}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ {"bytes" : 12641, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 4384, "count" : 14}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20642, "string" : {"bytes" : 1568, "count" : 28}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ 12641 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ 12641 ][ 10393 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ true ]
+0029   OP_POP
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ {"bytes" : 14833, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 6576, "count" : 21}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20642, "string" : {"bytes" : 1568, "count" : 28}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ {"bytes" : 14833, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 6576, "count" : 21}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20642, "string" : {"bytes" : 1568, "count" : 28}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xx" ][ 10393 ][ 1 ][ 14833 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ nil ][ "xx" ][ 14833 ][ 1 ][ 14833 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "xx" ][ 14833 ][ 1 ][ "xx" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xx" ][ 14833 ][ 1 ][ "xx" ][ "xx" ]
+0059   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xx" ][ 14833 ][ 1 ][ "xxxx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 1 ][ "xxxx" ]
+0062   OP_POP
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 1 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 1 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ 2 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+gc collect 8824 bytes
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ {"bytes" : 17081, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 8768, "count" : 28}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20642, "string" : {"bytes" : 1624, "count" : 29}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ {"bytes" : 17081, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 8768, "count" : 28}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20642, "string" : {"bytes" : 1624, "count" : 29}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ 17081 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ 17081 ][ 14833 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ true ]
+0029   OP_POP
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ {"bytes" : 10449, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 2192, "count" : 7}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1568, "count" : 28}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ {"bytes" : 10449, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 2192, "count" : 7}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1568, "count" : 28}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xxxx" ][ 14833 ][ 2 ][ 10449 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ nil ][ "xxxx" ][ 10449 ][ 2 ][ 10449 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "xxxx" ][ 10449 ][ 2 ][ "xxxx" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxx" ][ 10449 ][ 2 ][ "xxxx" ][ "xxxx" ]
+0059   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "xxxx" ][ 10449 ][ 2 ][ "xxxxxxxx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 2 ][ "xxxxxxxx" ]
+0062   OP_POP
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 2 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 2 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ 3 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ {"bytes" : 12697, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 4384, "count" : 14}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1624, "count" : 29}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ {"bytes" : 12697, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 4384, "count" : 14}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1624, "count" : 29}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ 12697 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ 12697 ][ 10449 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ true ]
+0029   OP_POP
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ {"bytes" : 14889, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 6576, "count" : 21}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1624, "count" : 29}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ {"bytes" : 14889, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 6576, "count" : 21}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1624, "count" : 29}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xxxxxxxx" ][ 10449 ][ 3 ][ 14889 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ nil ][ "xxxxxxxx" ][ 14889 ][ 3 ][ 14889 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "xxxxxxxx" ][ 14889 ][ 3 ][ "xxxxxxxx" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxx" ][ 14889 ][ 3 ][ "xxxxxxxx" ][ "xxxxxxxx" ]
+0059   OP_ADD_STR
+allocate: 56
+allocate: 31
+           stackframe: [ nil ][ "xxxxxxxx" ][ 14889 ][ 3 ][ "xxxxxxxxxxxxxxxx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 3 ][ "xxxxxxxxxxxxxxxx" ]
+0062   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 3 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 3 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ 4 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ {"bytes" : 17168, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 8768, "count" : 28}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1711, "count" : 30}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ {"bytes" : 17168, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 8768, "count" : 28}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1711, "count" : 30}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ 17168 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ 17168 ][ 14889 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ true ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ true ]
+0029   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ]
+0030 OP_JUMP          30   -> 44
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ]
+0044   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ <native gcStats> ]
+0047   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+gc collect 11072 bytes
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ {"bytes" : 19360, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 10960, "count" : 35}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1711, "count" : 30}} ]
+0049   OP_CONSTANT [6] "bytes"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ {"bytes" : 19360, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 10960, "count" : 35}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20754, "string" : {"bytes" : 1711, "count" : 30}} ][ "bytes" ]
+0051   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 14889 ][ 4 ][ 19360 ]
+0052   OP_SET_LOCAL [2] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 19360 ][ 4 ][ 19360 ]
+0054   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 19360 ][ 4 ][ "xxxxxxxxxxxxxxxx" ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 19360 ][ 4 ][ "xxxxxxxxxxxxxxxx" ][ "xxxxxxxxxxxxxxxx" ]
+0059   OP_ADD_STR
+allocate: 56
+allocate: 33
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxx" ][ 19360 ][ 4 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0060   OP_SET_LOCAL [1] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 4 ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ]
+0062   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 4 ]
+0063 OP_LOOP          63   -> 33
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 4 ]
+0033   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ]
+0006   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ 5 ][ 24 ]
+0010   OP_LESS_INT
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ true ]
+0011 OP_JUMP_IF_FALSE 11   -> 66
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ true ]
+0014   OP_POP
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ]
+0015   OP_GET_GLOBAL [5] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ <native gcStats> ]
+0018   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ {"bytes" : 10569, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 2192, "count" : 7}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20816, "string" : {"bytes" : 1688, "count" : 29}} ]
+0020   OP_CONSTANT [4] "bytes"
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ {"bytes" : 10569, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 3520, "count" : 4}, "function" : {"bytes" : 1481, "count" : 3}, "json" : {"bytes" : 2192, "count" : 7}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 20816, "string" : {"bytes" : 1688, "count" : 29}} ][ "bytes" ]
+0022   OP_GET_ELEMENT
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ 10569 ]
+0023   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ 10569 ][ 19360 ]
+0025   OP_GREATER_EQUAL
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ false ]
+0026 OP_JUMP_IF_FALSE 26   -> 66
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ 5 ][ false ]
+0066   OP_POPN size: 2
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ]
+0068   OP_NIL
+           stackframe: [ nil ][ "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx" ][ 19360 ][ nil ]
+0069   OP_RETURN
+           stackframe: [ nil ][ "middle kept 2" ][ <coroutine <closure <fn "grow">>> ]
+0016   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ "middle kept 2" ][ <coroutine <closure <fn "grow">>> ][ "middle kept 2" ]
+0018   OP_PRINT
+"middle kept 2"
+           stackframe: [ nil ][ "middle kept 2" ][ <coroutine <closure <fn "grow">>> ]
+0019   OP_NIL
+           stackframe: [ nil ][ "middle kept 2" ][ <coroutine <closure <fn "grow">>> ][ nil ]
+0020   OP_RETURN
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ][ <coroutine <closure <fn "middle">>> ]
+0043   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ][ <coroutine <closure <fn "middle">>> ][ "hello world 1" ]
+0045   OP_PRINT
+"hello world 1"
+           stackframe: [ <closure <script>> ][ "hello world 1" ][ <coroutine <closure <fn "grow">>> ][ <coroutine <closure <fn "middle">>> ]
+0046   OP_POPN size: 3
+           stackframe: [ <closure <script>> ]
+0048   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0049   OP_RETURN
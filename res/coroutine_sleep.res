@@ -0,0 +1,945 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 32
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 64
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 256
+allocate: 64
+allocate: 256
+allocate: 128
+allocate: 56
+allocate: 128
+allocate: 512
+allocate: 73
+allocate: 292
+=== "collect"===
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 24
+allocate: 96
+=== "sleeper"===
+allocate: 64
+allocate: 56
+allocate: 768
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 51
+allocate: 204
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CONSTANT [0] 1
+           stackframe: [ <closure <script>> ][ 1 ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_CLOSURE [1] <fn "collect">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ]
+0007   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0010   OP_CLOSURE [2] <fn "sleeper">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "sleeper">> ]
+0012   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0015   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "sleeper">> ]
+0018   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "sleeper">>> ]
+0020   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0023   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ]
+0026   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ]
+0002   OP_CONSTANT [1] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0004   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 0 ][ 100000 ]
+0008   OP_LESS
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0009 OP_JUMP_IF_FALSE 9    -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0012   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0013   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ <native gcStats> ]
+0016   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 56
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"bytes" : 5948, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 952, "count" : 17}} ]
+0018   OP_CONSTANT [3] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"bytes" : 5948, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 952, "count" : 17}} ][ "bytes" ]
+0020   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 5948 ]
+0021   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 5948 ][ 0 ]
+0023   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0024 OP_JUMP_IF_FALSE 24   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0027   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0028 OP_JUMP          28   -> 42
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0042   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ <native gcStats> ]
+0045   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 512
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"bytes" : 8212, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1344, "count" : 24}} ]
+0047   OP_CONSTANT [5] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"bytes" : 8212, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1344, "count" : 24}} ][ "bytes" ]
+0049   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 8212 ]
+0050   OP_SET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ][ 8212 ]
+0052   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ]
+0053   OP_CONSTANT [6] "x"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ][ "x" ]
+0055   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ][ "x" ][ 0 ]
+0057   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ][ "x0" ]
+0058   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ][ "x0" ][ "x0" ]
+0060   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ][ "x0" ][ "x0" ][ "x0" ]
+0062   OP_ARRAY size: 2
+allocate: 40
+allocate: 32
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ][ "x0" ][ ["x0", "x0"] ]
+0064   OP_POPN size: 2
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ]
+0066 OP_LOOP          66   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 0 ]
+0031   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ]
+0004   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ 1 ][ 100000 ]
+0008   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ true ]
+0009 OP_JUMP_IF_FALSE 9    -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ true ]
+0012   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ]
+0013   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ <native gcStats> ]
+0016   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ {"array" : {"bytes" : 72, "count" : 1}, "bytes" : 10844, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 4064, "count" : 13}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1456, "count" : 26}} ]
+0018   OP_CONSTANT [3] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ {"array" : {"bytes" : 72, "count" : 1}, "bytes" : 10844, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 4064, "count" : 13}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1456, "count" : 26}} ][ "bytes" ]
+0020   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ 10844 ]
+0021   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ 10844 ][ 8212 ]
+0023   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ true ]
+0024 OP_JUMP_IF_FALSE 24   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ true ]
+0027   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ]
+0028 OP_JUMP          28   -> 42
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ]
+0042   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ <native gcStats> ]
+0045   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ {"array" : {"bytes" : 72, "count" : 1}, "bytes" : 13412, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 6576, "count" : 21}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1512, "count" : 27}} ]
+0047   OP_CONSTANT [5] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ {"array" : {"bytes" : 72, "count" : 1}, "bytes" : 13412, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 6576, "count" : 21}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1512, "count" : 27}} ][ "bytes" ]
+0049   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 8212 ][ 1 ][ 13412 ]
+0050   OP_SET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ][ 13412 ]
+0052   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ]
+0053   OP_CONSTANT [6] "x"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ][ "x" ]
+0055   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ][ "x" ][ 1 ]
+0057   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ][ "x1" ]
+0058   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ][ "x1" ][ "x1" ]
+0060   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ][ "x1" ][ "x1" ][ "x1" ]
+0062   OP_ARRAY size: 2
+allocate: 40
+allocate: 32
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ][ "x1" ][ ["x1", "x1"] ]
+0064   OP_POPN size: 2
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ]
+0066 OP_LOOP          66   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 1 ]
+0031   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 9848 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ]
+0004   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ 2 ][ 100000 ]
+0008   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ true ]
+0009 OP_JUMP_IF_FALSE 9    -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ true ]
+0012   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ]
+0013   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ <native gcStats> ]
+0016   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 56
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ {"bytes" : 6204, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 12264, "string" : {"bytes" : 952, "count" : 17}} ]
+0018   OP_CONSTANT [3] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ {"bytes" : 6204, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 12264, "string" : {"bytes" : 952, "count" : 17}} ][ "bytes" ]
+0020   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ 6204 ]
+0021   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ 6204 ][ 13412 ]
+0023   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ false ]
+0024 OP_JUMP_IF_FALSE 24   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ 2 ][ false ]
+0069   OP_POPN size: 2
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ]
+0071   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 13412 ][ nil ]
+0072   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0028   OP_POP
+           stackframe: [ <closure <script>> ]
+0029   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "sleeper">>> ]
+0032   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0000   OP_CONSTANT [0] "abc"
+           stackframe: [ nil ][ "abc" ]
+0002   OP_GET_GLOBAL [9] 
+           stackframe: [ nil ][ "abc" ][ 1 ]
+0005   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "abc1" ]
+0006   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ "abc1" ][ "abc1" ]
+0008   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ "abc1" ][ "abc1" ][ "abc1" ]
+0010   OP_ARRAY size: 2
+allocate: 40
+allocate: 32
+           stackframe: [ nil ][ "abc1" ][ ["abc1", "abc1"] ]
+0012   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ]
+0033   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ]
+0036   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ]
+0002   OP_CONSTANT [1] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0004   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 0 ][ 100000 ]
+0008   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0009 OP_JUMP_IF_FALSE 9    -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0012   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0013   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ <native gcStats> ]
+0016   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"array" : {"bytes" : 72, "count" : 1}, "bytes" : 8596, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 12264, "string" : {"bytes" : 1400, "count" : 25}} ]
+0018   OP_CONSTANT [3] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"array" : {"bytes" : 72, "count" : 1}, "bytes" : 8596, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 12264, "string" : {"bytes" : 1400, "count" : 25}} ][ "bytes" ]
+0020   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 8596 ]
+0021   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 8596 ][ 0 ]
+0023   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0024 OP_JUMP_IF_FALSE 24   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0027   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0028 OP_JUMP          28   -> 42
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0042   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ <native gcStats> ]
+0045   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+gc collect 4384 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"array" : {"bytes" : 72, "count" : 1}, "bytes" : 11220, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 4384, "count" : 14}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 12264, "string" : {"bytes" : 1512, "count" : 27}} ]
+0047   OP_CONSTANT [5] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"array" : {"bytes" : 72, "count" : 1}, "bytes" : 11220, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 4384, "count" : 14}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 12264, "string" : {"bytes" : 1512, "count" : 27}} ][ "bytes" ]
+0049   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 11220 ]
+0050   OP_SET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ][ 11220 ]
+0052   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ]
+0053   OP_CONSTANT [6] "x"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ][ "x" ]
+0055   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ][ "x" ][ 0 ]
+0057   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ][ "x0" ]
+0058   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ][ "x0" ][ "x0" ]
+0060   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ][ "x0" ][ "x0" ][ "x0" ]
+0062   OP_ARRAY size: 2
+allocate: 40
+allocate: 32
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ][ "x0" ][ ["x0", "x0"] ]
+0064   OP_POPN size: 2
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ]
+0066 OP_LOOP          66   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 0 ]
+0031   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ]
+0004   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ 1 ][ 100000 ]
+0008   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ true ]
+0009 OP_JUMP_IF_FALSE 9    -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ true ]
+0012   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ]
+0013   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ <native gcStats> ]
+0016   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ {"array" : {"bytes" : 144, "count" : 2}, "bytes" : 9476, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 2512, "count" : 8}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 18552, "string" : {"bytes" : 1568, "count" : 28}} ]
+0018   OP_CONSTANT [3] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ {"array" : {"bytes" : 144, "count" : 2}, "bytes" : 9476, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 2512, "count" : 8}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 18552, "string" : {"bytes" : 1568, "count" : 28}} ][ "bytes" ]
+0020   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ 9476 ]
+0021   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ 9476 ][ 11220 ]
+0023   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ false ]
+0024 OP_JUMP_IF_FALSE 24   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ 1 ][ false ]
+0069   OP_POPN size: 2
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ]
+0071   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 11220 ][ nil ]
+0072   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0038   OP_POP
+           stackframe: [ <closure <script>> ]
+0039   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ]
+0042   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ]
+0002   OP_CONSTANT [1] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0004   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 0 ][ 100000 ]
+0008   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0009 OP_JUMP_IF_FALSE 9    -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0012   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0013   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ <native gcStats> ]
+0016   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"array" : {"bytes" : 144, "count" : 2}, "bytes" : 11988, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 5024, "count" : 16}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 18552, "string" : {"bytes" : 1568, "count" : 28}} ]
+0018   OP_CONSTANT [3] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"array" : {"bytes" : 144, "count" : 2}, "bytes" : 11988, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 5024, "count" : 16}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 18552, "string" : {"bytes" : 1568, "count" : 28}} ][ "bytes" ]
+0020   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 11988 ]
+0021   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 11988 ][ 0 ]
+0023   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0024 OP_JUMP_IF_FALSE 24   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ true ]
+0027   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0028 OP_JUMP          28   -> 42
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ]
+0042   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ <native gcStats> ]
+0045   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"array" : {"bytes" : 144, "count" : 2}, "bytes" : 14500, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 7536, "count" : 24}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 18552, "string" : {"bytes" : 1568, "count" : 28}} ]
+0047   OP_CONSTANT [5] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ {"array" : {"bytes" : 144, "count" : 2}, "bytes" : 14500, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "json" : {"bytes" : 7536, "count" : 24}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 18552, "string" : {"bytes" : 1568, "count" : 28}} ][ "bytes" ]
+0049   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 0 ][ 0 ][ 14500 ]
+0050   OP_SET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ][ 14500 ]
+0052   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ]
+0053   OP_CONSTANT [6] "x"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ][ "x" ]
+0055   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ][ "x" ][ 0 ]
+0057   OP_ADD
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ][ "x0" ]
+0058   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ][ "x0" ][ "x0" ]
+0060   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ][ "x0" ][ "x0" ][ "x0" ]
+0062   OP_ARRAY size: 2
+allocate: 40
+allocate: 32
+gc collect 10624 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ][ "x0" ][ ["x0", "x0"] ]
+0064   OP_POPN size: 2
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ]
+0066 OP_LOOP          66   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 0 ]
+0031   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ]
+0004   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ 1 ][ 100000 ]
+0008   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ true ]
+0009 OP_JUMP_IF_FALSE 9    -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ true ]
+0012   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ]
+0013   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ <native gcStats> ]
+0016   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 56
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ {"array" : {"bytes" : 144, "count" : 2}, "bytes" : 6460, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 12776, "string" : {"bytes" : 1064, "count" : 19}} ]
+0018   OP_CONSTANT [3] "bytes"
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ {"array" : {"bytes" : 144, "count" : 2}, "bytes" : 6460, "closure" : {"bytes" : 144, "count" : 3}, "coroutine" : {"bytes" : 1760, "count" : 2}, "function" : {"bytes" : 1420, "count" : 3}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 12776, "string" : {"bytes" : 1064, "count" : 19}} ][ "bytes" ]
+0020   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ 6460 ]
+0021   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ 6460 ][ 14500 ]
+0023   OP_GREATER_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ false ]
+0024 OP_JUMP_IF_FALSE 24   -> 69
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ 1 ][ false ]
+0069   OP_POPN size: 2
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ]
+0071   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "collect">> ][ 14500 ][ nil ]
+0072   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0044   OP_POP
+           stackframe: [ <closure <script>> ]
+0045   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "sleeper">>> ]
+0048   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ "abc1" ][ ["abc1", "abc1"] ]
+0013   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "abc1" ][ ["abc1", "abc1"] ][ ["abc1", "abc1"] ][ 0 ]
+0017   OP_GET_ELEMENT
+           stackframe: [ nil ][ "abc1" ][ ["abc1", "abc1"] ][ "abc1" ]
+0018   OP_PRINT
+"abc1"
+           stackframe: [ nil ][ "abc1" ][ ["abc1", "abc1"] ]
+0019   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ "abc1" ][ ["abc1", "abc1"] ][ "abc1" ]
+0021   OP_PRINT
+"abc1"
+           stackframe: [ nil ][ "abc1" ][ ["abc1", "abc1"] ]
+0022   OP_NIL
+           stackframe: [ nil ][ "abc1" ][ ["abc1", "abc1"] ][ nil ]
+0023   OP_RETURN
+           stackframe: [ <closure <script>> ]
+0049   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0050   OP_RETURN
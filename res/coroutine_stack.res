@@ -0,0 +1,2200 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 152
+allocate: 56
+allocate: 256
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
+=== "get"===
+allocate: 16
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 152
+allocate: 56
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 7
+allocate: 28
+=== "set"===
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 128
+allocate: 128
+allocate: 512
+allocate: 63
+allocate: 252
+=== "deep"===
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 14
+allocate: 56
+=== "runner"===
+allocate: 64
+allocate: 56
+allocate: 768
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 31
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 23
+allocate: 92
+=== "tick"===
+allocate: 56
+allocate: 256
+allocate: 128
+allocate: 512
+allocate: 256
+allocate: 1024
+allocate: 512
+allocate: 185
+allocate: 740
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_CLOSURE [1] <fn "deep">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ]
+0007   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0010   OP_CLOSURE [2] <fn "runner">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "runner">> ]
+0012   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0015   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "runner">> ]
+0018   OP_CONSTANT [3] 10
+           stackframe: [ <closure <script>> ][ <closure <fn "runner">> ][ 10 ]
+0020   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "runner">>> ]
+0022   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0025   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "runner">>> ]
+0028   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 10 ]
+0000   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ]
+0003   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ]
+0005   OP_TRUE
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ]
+0006   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ]
+0041   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ]
+0041   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ]
+0041   OP_CALL [2] 
+allocate: 384
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ]
+0041   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+allocate: 1024
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ]
+0041   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ]
+0041   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ]
+0041   OP_CALL [2] 
+allocate: 768
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ]
+0041   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ]
+0041   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ]
+0039   OP_GET_LOCAL [2] 
+allocate: 2048
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ]
+0041   OP_CALL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0015   OP_GET_LOCAL [2] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ true ]
+0017 OP_JUMP_IF_FALSE 17   -> 25
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ true ]
+0020   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0021   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ]
+0029   OP_CONSTANT [4] "suspended at the bottom"
+           stackframe: [ <closure <script>> ][ "suspended at the bottom" ]
+0031   OP_PRINT
+"suspended at the bottom"
+           stackframe: [ <closure <script>> ]
+0032   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "runner">>> ]
+0035   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0022 OP_JUMP          22   -> 26
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0026   OP_GET_LOCAL [4] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "get">> ]
+0028   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "get">> ][ 0 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ true ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ]
+0030   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 1 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ][ 2 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ][ 2 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "get">> ][ 2 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ 2 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ 2 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 2 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ][ 4 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ][ 4 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "get">> ][ 4 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ 4 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ 6 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 3 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ][ 6 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ][ 6 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "get">> ][ 6 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ 6 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ 12 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 4 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ][ 8 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ][ 8 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "get">> ][ 8 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ 8 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ 20 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 5 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ][ 10 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ][ 10 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "get">> ][ 10 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ 10 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ 30 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 6 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ]
+0050   OP_CALL [1] 
+gc collect 960 bytes
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ][ 12 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ][ 12 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "get">> ][ 12 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ 12 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ true ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ 42 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 7 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ][ 14 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ][ 14 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "get">> ][ 14 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ 14 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ true ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ 56 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 8 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ][ 16 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ][ 16 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "get">> ][ 16 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ 16 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ true ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ 72 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 9 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ][ 18 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ][ 18 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "get">> ][ 18 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ 18 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ true ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ 90 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 10 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ]
+0050   OP_CALL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ][ 20 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ][ 20 ]
+0004   OP_POP
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ]
+0005   OP_NIL
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "get">> ][ 20 ]
+0002   OP_RETURN
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ 20 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 10 ][ <closure <fn "deep">> ][ 10 ][ true ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ 110 ]
+0060   OP_RETURN
+           stackframe: [ nil ][ 10 ][ 110 ]
+0008   OP_SET_GLOBAL [9] 
+           stackframe: [ nil ][ 10 ][ 110 ]
+0011   OP_POP
+           stackframe: [ nil ][ 10 ]
+0012   OP_NIL
+           stackframe: [ nil ][ 10 ][ nil ]
+0013   OP_RETURN
+           stackframe: [ <closure <script>> ]
+0036   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ 110 ]
+0039   OP_PRINT
+110
+           stackframe: [ <closure <script>> ]
+0040   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ]
+0043   OP_CONSTANT [5] 10
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ]
+0045   OP_FALSE
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ]
+0046   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ]
+0041   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ]
+0041   OP_CALL [2] 
+gc collect 800 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ]
+0041   OP_CALL [2] 
+allocate: 384
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ]
+0041   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+allocate: 1024
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ]
+0041   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ]
+0041   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ]
+0041   OP_CALL [2] 
+allocate: 768
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ]
+0041   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ]
+0041   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0031   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ]
+0034   OP_SUPER_GET_LOCAL_CONSTANT_SUB (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ]
+0039   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ]
+0041   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ]
+0000   OP_GET_LOCAL [1] 
+allocate: 2048
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ]
+0002   OP_CLOSURE [0] <fn "get">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ]
+0006   OP_CLOSURE [1] <fn "set">
+allocate: 48
+allocate: 8
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0010 OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST [1] 0 10   -> 31
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ]
+0015   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ false ]
+0017 OP_JUMP_IF_FALSE 17   -> 25
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ false ]
+0025   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "get">> ]
+0028   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "get">> ][ 0 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 0 ][ false ][ 0 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ]
+0030   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 1 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 1 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ][ 2 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ][ 2 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "set">> ][ 2 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ <closure <fn "get">> ][ 2 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ 2 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 1 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 0 ][ 2 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 2 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 2 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ][ 4 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ][ 4 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "set">> ][ 4 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ <closure <fn "get">> ][ 4 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ 4 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 2 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 2 ][ 6 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 3 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ]
+0050   OP_CALL [1] 
+gc collect 480 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 3 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ][ 6 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ][ 6 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "set">> ][ 6 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ <closure <fn "get">> ][ 6 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ 6 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 3 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 6 ][ 12 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 4 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 4 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ][ 8 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ][ 8 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "set">> ][ 8 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ <closure <fn "get">> ][ 8 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ 8 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 4 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 12 ][ 20 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 5 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 5 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ][ 10 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ][ 10 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "set">> ][ 10 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ <closure <fn "get">> ][ 10 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ 10 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 5 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 20 ][ 30 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 6 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 6 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ][ 12 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ][ 12 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "set">> ][ 12 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ <closure <fn "get">> ][ 12 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ 12 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 6 ][ false ][ 12 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 30 ][ 42 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 7 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 7 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ][ 14 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ][ 14 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "set">> ][ 14 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ <closure <fn "get">> ][ 14 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ 14 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 7 ][ false ][ 14 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 42 ][ 56 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 8 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 8 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ][ 16 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ][ 16 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "set">> ][ 16 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ <closure <fn "get">> ][ 16 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ 16 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 8 ][ false ][ 16 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 56 ][ 72 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 9 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 9 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ][ 18 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ][ 18 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "set">> ][ 18 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ <closure <fn "get">> ][ 18 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ 18 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ <closure <fn "deep">> ][ 9 ][ false ][ 18 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 72 ][ 90 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ]
+0043   OP_SUPER_GET_LOCAL_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 10 ][ 2 ]
+0049   OP_MUL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ]
+0050   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 10 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ][ 20 ]
+0002   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ][ 20 ]
+0004   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ]
+0005   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "set">> ][ 20 ][ nil ]
+0006   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ nil ]
+0052   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "get">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "get">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ <closure <fn "get">> ][ 20 ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ 20 ]
+0057   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "deep">> ][ 10 ][ false ][ 20 ][ <closure <fn "get">> ][ <closure <fn "set">> ][ 90 ][ 110 ]
+0060   OP_RETURN
+           stackframe: [ <closure <script>> ][ 110 ]
+0048   OP_PRINT
+110
+           stackframe: [ <closure <script>> ]
+0049   OP_CONSTANT [6] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0051   OP_DEFINE_GLOBAL [13] 
+           stackframe: [ <closure <script>> ]
+0054   OP_CLOSURE [7] <fn "tick">
+allocate: 48
+gc collect 1280 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "tick">> ]
+0056   OP_DEFINE_GLOBAL [14] 
+           stackframe: [ <closure <script>> ]
+0059   OP_ARRAY size: 0
+allocate: 40
+           stackframe: [ <closure <script>> ][ [] ]
+0061   OP_DEFINE_GLOBAL [15] 
+           stackframe: [ <closure <script>> ]
+0064   OP_CONSTANT [8] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 0 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 0 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+allocate: 16
+           stackframe: [ <closure <script>> ][ 0 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 0 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 0 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 1 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 1 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+allocate: 32
+           stackframe: [ <closure <script>> ][ 1 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 1 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 1 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 2 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 2 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+allocate: 64
+           stackframe: [ <closure <script>> ][ 2 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 2 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 2 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 3 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 3 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 3 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 3 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 3 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 4 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 4 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 4 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 4 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 4 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 4 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 4 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 4 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+allocate: 128
+           stackframe: [ <closure <script>> ][ 4 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 4 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 4 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 5 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 5 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 5 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 5 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 5 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 5 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 5 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 5 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 5 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 5 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 5 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 6 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 6 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 6 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 6 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 6 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 6 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 6 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 6 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 6 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 6 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 6 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 7 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 7 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 7 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 7 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 7 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 7 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 7 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 7 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 7 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 7 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 7 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 8 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 8 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 8 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 8 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 8 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 8 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 8 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 8 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+allocate: 256
+           stackframe: [ <closure <script>> ][ 8 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 8 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 8 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 9 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 9 ]
+0071 OP_JUMP          71   -> 85
+           stackframe: [ <closure <script>> ][ 9 ]
+0085   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 9 ][ <native push> ]
+0088   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 9 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0091   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ 9 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ]
+0094   OP_CONSTANT [11] 1
+           stackframe: [ <closure <script>> ][ 9 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <closure <fn "tick">> ][ 1 ]
+0096   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 9 ][ <native push> ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ <coroutine <closure <fn "tick">>> ]
+0098   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 9 ][ nil ]
+0100   OP_POP
+           stackframe: [ <closure <script>> ][ 9 ]
+0101 OP_LOOP          101  -> 74
+           stackframe: [ <closure <script>> ][ 9 ]
+0074   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 10 ]
+0066 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 66   -> 104
+           stackframe: [ <closure <script>> ][ 10 ]
+0104   OP_POP
+           stackframe: [ <closure <script>> ]
+0105   OP_CONSTANT [12] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 0 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 0 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 0 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 0 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 0 ]
+0131   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 0 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 0 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 0 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 1 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 1 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 0 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 0 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 0 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 1 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 1 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 1 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 1 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 1 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 1 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 1 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 1 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 2 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 2 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 1 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 1 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 1 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 2 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 2 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 2 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 2 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 2 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 2 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 2 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 2 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 3 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 3 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 2 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 2 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 2 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 3 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 3 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 3 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 3 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 3 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 3 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 3 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 3 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 4 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 4 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 3 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 3 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 3 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 4 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 4 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 4 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 4 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 4 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 4 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 4 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 4 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 4 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 5 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 5 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 4 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 4 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 4 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 5 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 5 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 5 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 5 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 5 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 5 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 5 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 5 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 5 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 6 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 6 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 5 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 5 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 5 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 6 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 6 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 6 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 6 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 6 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 6 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 6 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 6 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 6 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 7 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 7 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 6 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 6 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 6 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 7 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 7 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 7 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 7 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 7 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 7 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 7 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 7 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 7 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 8 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 8 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 7 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 7 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 7 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 8 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 8 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 8 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 8 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 8 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 8 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 8 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 8 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 8 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 9 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 9 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 8 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 8 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 8 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 9 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 9 ]
+0112 OP_JUMP          112  -> 126
+           stackframe: [ <closure <script>> ][ 9 ]
+0126   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 9 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0129   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 9 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 9 ]
+0131   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 9 ][ <coroutine <closure <fn "tick">>> ]
+0132   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 9 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0134   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0000   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 9 ]
+0003   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 10 ]
+0006   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 10 ]
+0009   OP_POP
+           stackframe: [ nil ][ 1 ]
+0010   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ 9 ][ <coroutine <closure <fn "tick">>> ]
+0135   OP_POP
+           stackframe: [ <closure <script>> ][ 9 ]
+0136 OP_LOOP          136  -> 115
+           stackframe: [ <closure <script>> ][ 9 ]
+0115   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 10 ]
+0107 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 107  -> 139
+           stackframe: [ <closure <script>> ][ 10 ]
+0139   OP_POP
+           stackframe: [ <closure <script>> ]
+0140   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 10 ]
+0143   OP_PRINT
+10
+           stackframe: [ <closure <script>> ]
+0144   OP_CONSTANT [15] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 0 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 0 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 0 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 0 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 0 ]
+0170   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 0 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 0 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 10 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 11 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 11 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 0 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 0 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 0 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 1 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 1 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 1 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 1 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 1 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 1 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 1 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 11 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 12 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 12 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 1 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 1 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 1 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 2 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 2 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 2 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 2 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 2 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 2 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 2 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 12 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 13 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 13 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 2 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 2 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 2 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 3 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 3 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 3 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 3 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 3 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 3 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 3 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 13 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 14 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 14 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 3 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 3 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 3 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 4 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 4 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 4 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 4 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 4 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 4 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 4 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 4 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 14 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 15 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 15 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 4 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 4 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 4 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 5 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 5 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 5 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 5 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 5 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 5 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 5 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 5 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 15 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 16 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 16 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 5 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 5 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 5 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 6 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 6 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 6 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 6 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 6 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 6 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 6 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 6 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 16 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 17 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 17 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 6 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 6 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 6 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 7 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 7 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 7 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 7 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 7 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 7 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 7 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 7 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 17 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 18 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 18 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 7 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 7 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 7 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 8 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 8 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 8 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 8 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 8 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 8 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 8 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 8 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 18 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 19 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 19 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 8 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 8 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 8 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 9 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 9 ]
+0151 OP_JUMP          151  -> 165
+           stackframe: [ <closure <script>> ][ 9 ]
+0165   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 9 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ]
+0168   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 9 ][ [<coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>, <coroutine <closure <fn "tick">>>] ][ 9 ]
+0170   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 9 ][ <coroutine <closure <fn "tick">>> ]
+0171   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ 9 ][ <coroutine <closure <fn "tick">>> ][ <coroutine <closure <fn "tick">>> ]
+0173   OP_RESUME_COROUTINE
+           stackframe: [ nil ][ 1 ]
+0011   OP_GET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 19 ]
+0014   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ 1 ][ 20 ]
+0017   OP_SET_GLOBAL [13] 
+           stackframe: [ nil ][ 1 ][ 20 ]
+0020   OP_POP
+           stackframe: [ nil ][ 1 ]
+0021   OP_NIL
+           stackframe: [ nil ][ 1 ][ nil ]
+0022   OP_RETURN
+           stackframe: [ <closure <script>> ][ 9 ][ <coroutine <closure <fn "tick">>> ]
+0174   OP_POP
+           stackframe: [ <closure <script>> ][ 9 ]
+0175 OP_LOOP          175  -> 154
+           stackframe: [ <closure <script>> ][ 9 ]
+0154   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 10 ]
+0146 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 146  -> 178
+           stackframe: [ <closure <script>> ][ 10 ]
+0178   OP_POP
+           stackframe: [ <closure <script>> ]
+0179   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 20 ]
+0182   OP_PRINT
+20
+           stackframe: [ <closure <script>> ]
+0183   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0184   OP_RETURN
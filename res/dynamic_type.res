@@ -1,91 +1,373 @@
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 96
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 192
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 136
-allocate: 80
-allocate: 40
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
 allocate: 16
+allocate: 8
 allocate: 32
+allocate: 56
+allocate: 32
+allocate: 16
+allocate: 64
 allocate: 64
-allocate: 80
-allocate: 40
 allocate: 128
+allocate: 32
+allocate: 128
+allocate: 56
 allocate: 256
-allocate: 80
-allocate: 40
-allocate: 136
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
 allocate: 16
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
 === "a"===
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 8
+allocate: 32
+=== "plus"===
+allocate: 256
+allocate: 56
+allocate: 128
+allocate: 512
+allocate: 56
+allocate: 56
+allocate: 768
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 8
+allocate: 32
+=== "less"===
+allocate: 512
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 8
+allocate: 32
+=== "get"===
+allocate: 256
+allocate: 1024
+allocate: 56
+allocate: 56
+allocate: 166
+allocate: 664
 === <script> ===
-allocate: 80
-allocate: 160
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
            stackframe: [ <closure <script>> ]
-0000   OP_CONSTANT [1] 1
+0000   OP_CONSTANT [0] 1
            stackframe: [ <closure <script>> ][ 1 ]
-0002   OP_DEFINE_GLOBAL [0] "type"
-allocate: 56
+0002   OP_DEFINE_GLOBAL [9] 
            stackframe: [ <closure <script>> ]
-0004   OP_CONSTANT [3] "123"
+0005   OP_CONSTANT [1] "123"
            stackframe: [ <closure <script>> ][ "123" ]
-0006   OP_SET_GLOBAL [2] "type"
+0007   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ "123" ]
-0008   OP_POP
+0010   OP_POP
            stackframe: [ <closure <script>> ]
-0009   OP_CONSTANT [5] 1
+0011   OP_CONSTANT [2] 1
            stackframe: [ <closure <script>> ][ 1 ]
-0011   OP_CONSTANT [6] 2
+0013   OP_CONSTANT [3] 2
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0013   OP_CONSTANT [7] 3
+0015   OP_CONSTANT [4] 3
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 3 ]
-0015   OP_ARRAY size: 3
-allocate: 72
+0017   OP_ARRAY size: 3
+allocate: 40
 allocate: 48
            stackframe: [ <closure <script>> ][ [1, 2, 3] ]
-0017   OP_SET_GLOBAL [4] "type"
+0019   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [1, 2, 3] ]
-0019   OP_POP
+0022   OP_POP
            stackframe: [ <closure <script>> ]
-0020   OP_GET_GLOBAL [8] "type"
+0023   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [1, 2, 3] ]
-0022   OP_PRINT
+0026   OP_PRINT
 [1, 2, 3]
            stackframe: [ <closure <script>> ]
-0023   OP_CLOSURE [10] <fn "a">
-allocate: 80
+0027   OP_CLOSURE [5] <fn "a">
+allocate: 48
            stackframe: [ <closure <script>> ][ <closure <fn "a">> ]
-0025   OP_DEFINE_GLOBAL [9] "a"
-allocate: 56
+0029   OP_DEFINE_GLOBAL [10] 
            stackframe: [ <closure <script>> ]
-0027   OP_GET_GLOBAL [12] "a"
+0032   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ <closure <fn "a">> ]
-0029   OP_SET_GLOBAL [11] "type"
+0035   OP_SET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <closure <fn "a">> ]
-0031   OP_POP
+0038   OP_POP
            stackframe: [ <closure <script>> ]
-0032   OP_GET_GLOBAL [13] "a"
+0039   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ <closure <fn "a">> ]
-0034   OP_PRINT
+0042   OP_PRINT
 <closure <fn "a">>
            stackframe: [ <closure <script>> ]
-0035   OP_NIL
+0043   OP_CLOSURE [6] <fn "plus">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ]
+0045   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0048   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ]
+0051   OP_CONSTANT [7] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 1 ]
+0053   OP_CONSTANT [8] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 1 ][ 2 ]
+0055   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 1 ][ 2 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 1 ][ 2 ][ 1 ]
+0002   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 1 ][ 2 ][ 3 ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ 3 ]
+0057   OP_PRINT
+3
+           stackframe: [ <closure <script>> ]
+0058   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ]
+0061   OP_CONSTANT [9] "a"
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "a" ]
+0063   OP_CONSTANT [10] "b"
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "a" ][ "b" ]
+0065   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "a" ][ "b" ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "a" ][ "b" ][ "a" ]
+0002   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "a" ][ "b" ][ "a" ][ "b" ]
+0004   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "a" ][ "b" ][ "ab" ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ "ab" ]
+0067   OP_PRINT
+"ab"
+           stackframe: [ <closure <script>> ]
+0068   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ]
+0071   OP_CONSTANT [11] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 3 ]
+0073   OP_CONSTANT [12] 4
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 3 ][ 4 ]
+0075   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 3 ][ 4 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 3 ][ 4 ][ 3 ]
+0002   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ 3 ][ 4 ][ 7 ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ 7 ]
+0077   OP_PRINT
+7
+           stackframe: [ <closure <script>> ]
+0078   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ]
+0081   OP_CONSTANT [13] "n"
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "n" ]
+0083   OP_CONSTANT [14] 5
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "n" ][ 5 ]
+0085   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "n" ][ 5 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "n" ][ 5 ][ "n" ]
+0002   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "n" ][ 5 ][ "n" ][ 5 ]
+0004   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "plus">> ][ "n" ][ 5 ][ "n5" ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ "n5" ]
+0087   OP_PRINT
+"n5"
+           stackframe: [ <closure <script>> ]
+0088   OP_CLOSURE [15] <fn "less">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ]
+0090   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0093   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ]
+0096   OP_CONSTANT [16] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 1 ]
+0098   OP_CONSTANT [17] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 1 ][ 2 ]
+0100   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 1 ][ 2 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 1 ][ 2 ][ 1 ]
+0002   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 1 ][ 2 ][ 1 ][ 2 ]
+0004   OP_LESS
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 1 ][ 2 ][ true ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ true ]
+0102   OP_PRINT
+true
+           stackframe: [ <closure <script>> ]
+0103   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ]
+0106   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 3 ]
+0108   OP_CONSTANT [19] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 3 ][ 2 ]
+0110   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 3 ][ 2 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 3 ][ 2 ][ 3 ]
+0002   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 3 ][ 2 ][ 3 ][ 2 ]
+0004   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ <closure <fn "less">> ][ 3 ][ 2 ][ false ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ false ]
+0112   OP_PRINT
+false
+           stackframe: [ <closure <script>> ]
+0113   OP_CLOSURE [20] <fn "get">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ]
+0115   OP_DEFINE_GLOBAL [13] 
+           stackframe: [ <closure <script>> ]
+0118   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ]
+0121   OP_CONSTANT [21] 7
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ 7 ]
+0123   OP_CONSTANT [22] 8
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ 7 ][ 8 ]
+0125   OP_CONSTANT [23] 9
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ 7 ][ 8 ][ 9 ]
+0127   OP_ARRAY size: 3
+allocate: 40
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ]
+0129   OP_CONSTANT [24] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 1 ]
+0131   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 1 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 1 ][ [7, 8, 9] ]
+0002   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 1 ][ [7, 8, 9] ][ 1 ]
+0004   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 1 ][ 8 ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ 8 ]
+0133   OP_PRINT
+8
+           stackframe: [ <closure <script>> ]
+0134   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ]
+0137   OP_CONSTANT [25] "key"
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ "key" ]
+0139   OP_CONSTANT [26] "value"
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ "key" ][ "value" ]
+0141   OP_JSON size: 1
+allocate: 72
+allocate: 48
+allocate: 104
+gc collect 288 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ {"key" : "value"} ]
+0143   OP_CONSTANT [27] "key"
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ {"key" : "value"} ][ "key" ]
+0145   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ {"key" : "value"} ][ "key" ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ {"key" : "value"} ][ "key" ][ {"key" : "value"} ]
+0002   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ {"key" : "value"} ][ "key" ][ {"key" : "value"} ][ "key" ]
+0004   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ {"key" : "value"} ][ "key" ][ "value" ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ "value" ]
+0147   OP_PRINT
+"value"
+           stackframe: [ <closure <script>> ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ]
+0151   OP_CONSTANT [28] 7
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ 7 ]
+0153   OP_CONSTANT [29] 8
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ 7 ][ 8 ]
+0155   OP_CONSTANT [30] 9
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ 7 ][ 8 ][ 9 ]
+0157   OP_ARRAY size: 3
+allocate: 40
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ]
+0159   OP_CONSTANT [31] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 2 ]
+0161   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 2 ]
+0000   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 2 ][ [7, 8, 9] ]
+0002   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 2 ][ [7, 8, 9] ][ 2 ]
+0004   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <closure <fn "get">> ][ [7, 8, 9] ][ 2 ][ 9 ]
+0005   OP_RETURN
+           stackframe: [ <closure <script>> ][ 9 ]
+0163   OP_PRINT
+9
+           stackframe: [ <closure <script>> ]
+0164   OP_NIL
            stackframe: [ <closure <script>> ][ nil ]
-0036   OP_RETURN
+0165   OP_RETURN
@@ -0,0 +1,2063 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 16
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 256
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 56
+allocate: 256
+allocate: 128
+allocate: 512
+allocate: 56
+allocate: 56
+allocate: 512
+allocate: 256
+allocate: 1024
+allocate: 129
+allocate: 516
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <native gcStats> ]
+0003   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ {"bytes" : 4533, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1008, "count" : 18}} ]
+0005   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0008   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {"bytes" : 4533, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1008, "count" : 18}} ]
+0011   OP_CONSTANT [0] "bytes"
+           stackframe: [ <closure <script>> ][ {"bytes" : 4533, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1008, "count" : 18}} ][ "bytes" ]
+0013   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 4533 ]
+0014   OP_CONSTANT [1] 0
+           stackframe: [ <closure <script>> ][ 4533 ][ 0 ]
+0016   OP_GREATER
+           stackframe: [ <closure <script>> ][ true ]
+0017   OP_PRINT
+true
+           stackframe: [ <closure <script>> ]
+0018   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {"bytes" : 4533, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1008, "count" : 18}} ]
+0021   OP_CONSTANT [2] "next"
+           stackframe: [ <closure <script>> ][ {"bytes" : 4533, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1008, "count" : 18}} ][ "next" ]
+0023   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 1048576 ]
+0024   OP_CONSTANT [3] 0
+           stackframe: [ <closure <script>> ][ 1048576 ][ 0 ]
+0026   OP_GREATER
+           stackframe: [ <closure <script>> ][ true ]
+0027   OP_PRINT
+true
+           stackframe: [ <closure <script>> ]
+0028   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {"bytes" : 4533, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1008, "count" : 18}} ]
+0031   OP_CONSTANT [4] "coroutine"
+           stackframe: [ <closure <script>> ][ {"bytes" : 4533, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 1048576, "string" : {"bytes" : 1008, "count" : 18}} ][ "coroutine" ]
+0033   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ {"bytes" : 880, "count" : 1} ]
+0034   OP_CONSTANT [5] "count"
+           stackframe: [ <closure <script>> ][ {"bytes" : 880, "count" : 1} ][ "count" ]
+0036   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 1 ]
+0037   OP_PRINT
+1
+           stackframe: [ <closure <script>> ]
+0038   OP_ARRAY size: 0
+allocate: 40
+           stackframe: [ <closure <script>> ][ [] ]
+0040   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0043   OP_CONSTANT [6] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 0 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 0 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ 0 ]
+0072   OP_CALL [2] 
+allocate: 16
+           stackframe: [ <closure <script>> ][ 0 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 0 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 0 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 1 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 1 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [0] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [0] ][ 1 ]
+0072   OP_CALL [2] 
+allocate: 32
+           stackframe: [ <closure <script>> ][ 1 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 1 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 1 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 2 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 2 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [0, 1] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [0, 1] ][ 2 ]
+0072   OP_CALL [2] 
+allocate: 64
+           stackframe: [ <closure <script>> ][ 2 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 2 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 2 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 3 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 3 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [0, 1, 2] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [0, 1, 2] ][ 3 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 3 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 3 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 3 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 4 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 4 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 4 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 4 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 4 ][ <native push> ][ [0, 1, 2, 3] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 4 ][ <native push> ][ [0, 1, 2, 3] ][ 4 ]
+0072   OP_CALL [2] 
+allocate: 128
+           stackframe: [ <closure <script>> ][ 4 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 4 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 4 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 5 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 5 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 5 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 5 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 5 ][ <native push> ][ [0, 1, 2, 3, 4] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 5 ][ <native push> ][ [0, 1, 2, 3, 4] ][ 5 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 5 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 5 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 5 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 6 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 6 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 6 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 6 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 6 ][ <native push> ][ [0, 1, 2, 3, 4, 5] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 6 ][ <native push> ][ [0, 1, 2, 3, 4, 5] ][ 6 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 6 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 6 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 6 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 7 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 7 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 7 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 7 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 7 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 7 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6] ][ 7 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 7 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 7 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 7 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 8 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 8 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 8 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 8 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 8 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 8 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7] ][ 8 ]
+0072   OP_CALL [2] 
+allocate: 256
+           stackframe: [ <closure <script>> ][ 8 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 8 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 8 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 9 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 9 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 9 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 9 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 9 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 9 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8] ][ 9 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 9 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 9 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 9 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 10 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 10 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 10 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 10 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 10 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 10 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9] ][ 10 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 10 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 10 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 10 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 11 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 11 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 11 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 11 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 11 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 11 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10] ][ 11 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 11 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 11 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 11 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 12 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 12 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 12 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 12 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 12 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 12 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11] ][ 12 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 12 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 12 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 12 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 13 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 13 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 13 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 13 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 13 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 13 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12] ][ 13 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 13 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 13 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 13 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 14 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 14 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 14 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 14 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 14 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 14 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13] ][ 14 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 14 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 14 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 14 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 15 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 15 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 15 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 15 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 15 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 15 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14] ][ 15 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 15 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 15 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 15 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 16 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 16 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 16 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 16 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 16 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 16 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15] ][ 16 ]
+0072   OP_CALL [2] 
+allocate: 512
+           stackframe: [ <closure <script>> ][ 16 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 16 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 16 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 17 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 17 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 17 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 17 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 17 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 17 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16] ][ 17 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 17 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 17 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 17 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 18 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 18 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 18 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 18 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 18 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 18 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17] ][ 18 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 18 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 18 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 18 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 19 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 19 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 19 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 19 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 19 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 19 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18] ][ 19 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 19 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 19 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 19 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 20 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 20 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 20 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 20 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 20 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 20 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19] ][ 20 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 20 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 20 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 20 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 21 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 21 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 21 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 21 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 21 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 21 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20] ][ 21 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 21 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 21 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 21 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 22 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 22 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 22 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 22 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 22 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 22 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21] ][ 22 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 22 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 22 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 22 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 23 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 23 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 23 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 23 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 23 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 23 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22] ][ 23 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 23 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 23 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 23 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 24 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 24 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 24 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 24 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 24 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 24 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23] ][ 24 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 24 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 24 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 24 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 25 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 25 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 25 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 25 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 25 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 25 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24] ][ 25 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 25 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 25 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 25 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 26 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 26 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 26 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 26 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 26 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 26 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25] ][ 26 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 26 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 26 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 26 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 27 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 27 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 27 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 27 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 27 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 27 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26] ][ 27 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 27 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 27 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 27 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 28 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 28 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 28 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 28 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 28 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 28 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27] ][ 28 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 28 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 28 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 28 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 29 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 29 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 29 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 29 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 29 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 29 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28] ][ 29 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 29 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 29 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 29 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 30 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 30 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 30 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 30 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 30 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 30 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29] ][ 30 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 30 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 30 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 30 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 31 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 31 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 31 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 31 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 31 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 31 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30] ][ 31 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 31 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 31 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 31 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 32 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 32 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 32 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 32 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 32 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 32 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31] ][ 32 ]
+0072   OP_CALL [2] 
+allocate: 1024
+           stackframe: [ <closure <script>> ][ 32 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 32 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 32 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 33 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 33 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 33 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 33 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 33 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 33 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32] ][ 33 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 33 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 33 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 33 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 34 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 34 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 34 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 34 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 34 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 34 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33] ][ 34 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 34 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 34 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 34 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 35 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 35 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 35 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 35 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 35 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 35 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34] ][ 35 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 35 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 35 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 35 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 36 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 36 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 36 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 36 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 36 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 36 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35] ][ 36 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 36 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 36 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 36 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 37 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 37 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 37 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 37 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 37 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 37 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36] ][ 37 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 37 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 37 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 37 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 38 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 38 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 38 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 38 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 38 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 38 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37] ][ 38 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 38 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 38 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 38 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 39 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 39 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 39 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 39 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 39 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 39 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38] ][ 39 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 39 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 39 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 39 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 40 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 40 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 40 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 40 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 40 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 40 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39] ][ 40 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 40 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 40 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 40 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 41 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 41 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 41 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 41 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 41 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 41 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40] ][ 41 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 41 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 41 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 41 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 42 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 42 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 42 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 42 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 42 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 42 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41] ][ 42 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 42 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 42 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 42 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 43 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 43 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 43 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 43 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 43 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 43 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42] ][ 43 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 43 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 43 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 43 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 44 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 44 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 44 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 44 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 44 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 44 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43] ][ 44 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 44 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 44 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 44 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 45 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 45 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 45 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 45 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 45 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 45 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44] ][ 45 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 45 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 45 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 45 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 46 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 46 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 46 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 46 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 46 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 46 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45] ][ 46 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 46 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 46 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 46 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 47 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 47 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 47 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 47 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 47 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 47 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46] ][ 47 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 47 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 47 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 47 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 48 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 48 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 48 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 48 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 48 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 48 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47] ][ 48 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 48 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 48 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 48 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 49 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 49 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 49 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 49 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 49 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 49 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48] ][ 49 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 49 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 49 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 49 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 50 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 50 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 50 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 50 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 50 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 50 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49] ][ 50 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 50 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 50 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 50 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 51 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 51 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 51 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 51 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 51 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 51 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50] ][ 51 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 51 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 51 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 51 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 52 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 52 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 52 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 52 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 52 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 52 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51] ][ 52 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 52 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 52 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 52 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 53 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 53 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 53 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 53 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 53 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 53 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52] ][ 53 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 53 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 53 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 53 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 54 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 54 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 54 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 54 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 54 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 54 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53] ][ 54 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 54 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 54 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 54 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 55 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 55 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 55 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 55 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 55 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 55 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54] ][ 55 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 55 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 55 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 55 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 56 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 56 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 56 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 56 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 56 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 56 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55] ][ 56 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 56 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 56 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 56 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 57 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 57 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 57 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 57 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 57 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 57 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56] ][ 57 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 57 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 57 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 57 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 58 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 58 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 58 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 58 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 58 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 58 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57] ][ 58 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 58 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 58 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 58 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 59 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 59 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 59 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 59 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 59 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 59 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58] ][ 59 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 59 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 59 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 59 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 60 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 60 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 60 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 60 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 60 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 60 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59] ][ 60 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 60 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 60 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 60 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 61 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 61 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 61 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 61 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 61 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 61 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60] ][ 61 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 61 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 61 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 61 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 62 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 62 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 62 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 62 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 62 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 62 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61] ][ 62 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 62 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 62 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 62 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 63 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 63 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 63 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 63 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 63 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 63 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62] ][ 63 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 63 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 63 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 63 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 64 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 64 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 64 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 64 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 64 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 64 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63] ][ 64 ]
+0072   OP_CALL [2] 
+allocate: 2048
+           stackframe: [ <closure <script>> ][ 64 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 64 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 64 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 65 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 65 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 65 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 65 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 65 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 65 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64] ][ 65 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 65 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 65 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 65 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 66 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 66 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 66 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 66 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 66 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 66 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65] ][ 66 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 66 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 66 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 66 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 67 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 67 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 67 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 67 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 67 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 67 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66] ][ 67 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 67 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 67 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 67 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 68 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 68 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 68 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 68 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 68 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 68 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67] ][ 68 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 68 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 68 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 68 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 69 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 69 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 69 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 69 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 69 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 69 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68] ][ 69 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 69 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 69 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 69 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 70 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 70 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 70 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 70 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 70 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 70 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69] ][ 70 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 70 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 70 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 70 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 71 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 71 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 71 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 71 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 71 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 71 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70] ][ 71 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 71 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 71 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 71 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 72 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 72 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 72 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 72 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 72 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 72 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71] ][ 72 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 72 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 72 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 72 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 73 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 73 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 73 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 73 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 73 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 73 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72] ][ 73 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 73 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 73 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 73 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 74 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 74 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 74 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 74 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 74 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 74 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73] ][ 74 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 74 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 74 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 74 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 75 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 75 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 75 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 75 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 75 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 75 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74] ][ 75 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 75 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 75 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 75 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 76 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 76 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 76 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 76 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 76 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 76 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75] ][ 76 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 76 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 76 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 76 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 77 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 77 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 77 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 77 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 77 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 77 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76] ][ 77 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 77 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 77 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 77 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 78 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 78 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 78 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 78 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 78 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 78 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77] ][ 78 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 78 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 78 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 78 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 79 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 79 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 79 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 79 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 79 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 79 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78] ][ 79 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 79 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 79 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 79 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 80 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 80 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 80 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 80 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 80 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 80 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79] ][ 80 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 80 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 80 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 80 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 81 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 81 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 81 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 81 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 81 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 81 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80] ][ 81 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 81 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 81 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 81 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 82 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 82 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 82 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 82 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 82 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 82 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81] ][ 82 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 82 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 82 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 82 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 83 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 83 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 83 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 83 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 83 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 83 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82] ][ 83 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 83 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 83 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 83 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 84 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 84 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 84 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 84 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 84 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 84 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83] ][ 84 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 84 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 84 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 84 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 85 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 85 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 85 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 85 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 85 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 85 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84] ][ 85 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 85 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 85 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 85 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 86 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 86 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 86 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 86 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 86 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 86 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85] ][ 86 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 86 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 86 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 86 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 87 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 87 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 87 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 87 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 87 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 87 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86] ][ 87 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 87 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 87 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 87 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 88 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 88 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 88 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 88 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 88 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 88 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87] ][ 88 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 88 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 88 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 88 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 89 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 89 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 89 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 89 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 89 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 89 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88] ][ 89 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 89 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 89 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 89 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 90 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 90 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 90 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 90 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 90 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 90 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89] ][ 90 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 90 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 90 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 90 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 91 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 91 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 91 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 91 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 91 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 91 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90] ][ 91 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 91 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 91 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 91 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 92 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 92 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 92 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 92 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 92 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 92 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91] ][ 92 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 92 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 92 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 92 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 93 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 93 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 93 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 93 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 93 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 93 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92] ][ 93 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 93 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 93 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 93 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 94 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 94 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 94 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 94 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 94 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 94 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93] ][ 94 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 94 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 94 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 94 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 95 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 95 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 95 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 95 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 95 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 95 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94] ][ 95 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 95 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 95 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 95 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 96 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 96 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 96 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 96 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 96 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 96 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95] ][ 96 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 96 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 96 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 96 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 97 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 97 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 97 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 97 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 97 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 97 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96] ][ 97 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 97 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 97 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 97 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 98 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 98 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 98 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 98 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 98 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 98 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97] ][ 98 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 98 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 98 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 98 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 99 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 99 ]
+0050 OP_JUMP          50   -> 64
+           stackframe: [ <closure <script>> ][ 99 ]
+0064   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 99 ][ <native push> ]
+0067   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 99 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98] ]
+0070   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 99 ][ <native push> ][ [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98] ][ 99 ]
+0072   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 99 ][ nil ]
+0074   OP_POP
+           stackframe: [ <closure <script>> ][ 99 ]
+0075 OP_LOOP          75   -> 53
+           stackframe: [ <closure <script>> ][ 99 ]
+0053   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 100 ]
+0045 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 100 45   -> 78
+           stackframe: [ <closure <script>> ][ 100 ]
+0078   OP_POP
+           stackframe: [ <closure <script>> ]
+0079   OP_GET_GLOBAL [5] 
+           stackframe: [ <closure <script>> ][ <native gcStats> ]
+0082   OP_CALL [0] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 56
+allocate: 48
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+allocate: 48
+           stackframe: [ <closure <script>> ][ {"array" : {"bytes" : 2088, "count" : 1}, "bytes" : 8661, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17178, "string" : {"bytes" : 1176, "count" : 21}} ]
+0084   OP_SET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {"array" : {"bytes" : 2088, "count" : 1}, "bytes" : 8661, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17178, "string" : {"bytes" : 1176, "count" : 21}} ]
+0087   OP_POP
+           stackframe: [ <closure <script>> ]
+0088   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {"array" : {"bytes" : 2088, "count" : 1}, "bytes" : 8661, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17178, "string" : {"bytes" : 1176, "count" : 21}} ]
+0091   OP_CONSTANT [9] "array"
+           stackframe: [ <closure <script>> ][ {"array" : {"bytes" : 2088, "count" : 1}, "bytes" : 8661, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17178, "string" : {"bytes" : 1176, "count" : 21}} ][ "array" ]
+0093   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ {"bytes" : 2088, "count" : 1} ]
+0094   OP_CONSTANT [10] "count"
+           stackframe: [ <closure <script>> ][ {"bytes" : 2088, "count" : 1} ][ "count" ]
+0096   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 1 ]
+0097   OP_CONSTANT [11] 0
+           stackframe: [ <closure <script>> ][ 1 ][ 0 ]
+0099   OP_GREATER
+           stackframe: [ <closure <script>> ][ true ]
+0100   OP_PRINT
+true
+           stackframe: [ <closure <script>> ]
+0101   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {"array" : {"bytes" : 2088, "count" : 1}, "bytes" : 8661, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17178, "string" : {"bytes" : 1176, "count" : 21}} ]
+0104   OP_CONSTANT [12] "array"
+           stackframe: [ <closure <script>> ][ {"array" : {"bytes" : 2088, "count" : 1}, "bytes" : 8661, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17178, "string" : {"bytes" : 1176, "count" : 21}} ][ "array" ]
+0106   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ {"bytes" : 2088, "count" : 1} ]
+0107   OP_CONSTANT [13] "bytes"
+           stackframe: [ <closure <script>> ][ {"bytes" : 2088, "count" : 1} ][ "bytes" ]
+0109   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 2088 ]
+0110   OP_CONSTANT [14] 800
+           stackframe: [ <closure <script>> ][ 2088 ][ 800 ]
+0112   OP_GREATER
+           stackframe: [ <closure <script>> ][ true ]
+0113   OP_PRINT
+true
+           stackframe: [ <closure <script>> ]
+0114   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {"array" : {"bytes" : 2088, "count" : 1}, "bytes" : 8661, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17178, "string" : {"bytes" : 1176, "count" : 21}} ]
+0117   OP_CONSTANT [15] "string"
+           stackframe: [ <closure <script>> ][ {"array" : {"bytes" : 2088, "count" : 1}, "bytes" : 8661, "closure" : {"bytes" : 48, "count" : 1}, "coroutine" : {"bytes" : 880, "count" : 1}, "function" : {"bytes" : 1309, "count" : 1}, "json" : {"bytes" : 1872, "count" : 6}, "native function" : {"bytes" : 576, "count" : 9}, "next" : 17178, "string" : {"bytes" : 1176, "count" : 21}} ][ "string" ]
+0119   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ {"bytes" : 1176, "count" : 21} ]
+0120   OP_CONSTANT [16] "count"
+           stackframe: [ <closure <script>> ][ {"bytes" : 1176, "count" : 21} ][ "count" ]
+0122   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 21 ]
+0123   OP_CONSTANT [17] 0
+           stackframe: [ <closure <script>> ][ 21 ][ 0 ]
+0125   OP_GREATER
+           stackframe: [ <closure <script>> ][ true ]
+0126   OP_PRINT
+true
+           stackframe: [ <closure <script>> ]
+0127   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0128   OP_RETURN
@@ -1,57 +1,120 @@
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 96
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 192
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
 allocate: 56
-allocate: 136
-allocate: 80
-allocate: 40
 allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 56
 allocate: 32
-allocate: 80
-allocate: 40
+allocate: 4
+allocate: 16
+allocate: 56
+allocate: 256
 allocate: 64
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 16
+allocate: 64
+allocate: 32
 allocate: 128
-allocate: 80
-allocate: 40
+allocate: 128
+allocate: 56
+allocate: 64
+allocate: 256
 allocate: 256
+allocate: 51
+allocate: 204
 === <script> ===
-allocate: 80
-allocate: 160
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
            stackframe: [ <closure <script>> ]
-0000   OP_CONSTANT [1] 1
+0000   OP_CONSTANT [0] 1
            stackframe: [ <closure <script>> ][ 1 ]
-0002   OP_CONSTANT [2] "first"
+0002   OP_CONSTANT [1] "first"
            stackframe: [ <closure <script>> ][ 1 ][ "first" ]
-0004   OP_CONSTANT [3] "2"
+0004   OP_CONSTANT [2] "2"
            stackframe: [ <closure <script>> ][ 1 ][ "first" ][ "2" ]
-0006   OP_CONSTANT [4] "second"
+0006   OP_CONSTANT [3] "second"
            stackframe: [ <closure <script>> ][ 1 ][ "first" ][ "2" ][ "second" ]
-0008   OP_JSON
-allocate: 104
+0008   OP_JSON size: 2
+allocate: 72
 allocate: 48
-gc collect 104 bytes
 allocate: 104
 allocate: 48
-allocate: 232
+           stackframe: [ <closure <script>> ][ {1 : "first", "2" : "second"} ]
+0010   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0013   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {1 : "first", "2" : "second"} ]
+0016   OP_PRINT
+{1 : "first", "2" : "second"}
+           stackframe: [ <closure <script>> ]
+0017   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {1 : "first", "2" : "second"} ]
+0020   OP_CONSTANT [4] 1
+           stackframe: [ <closure <script>> ][ {1 : "first", "2" : "second"} ][ 1 ]
+0022   OP_CONSTANT [5] "new"
+           stackframe: [ <closure <script>> ][ {1 : "first", "2" : "second"} ][ 1 ][ "new" ]
+0024   OP_SET_ELEMENT
+           stackframe: [ <closure <script>> ][ "new" ]
+0025   OP_POP
+           stackframe: [ <closure <script>> ]
+0026   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {1 : "new", "2" : "second"} ]
+0029   OP_PRINT
+{1 : "new", "2" : "second"}
+           stackframe: [ <closure <script>> ]
+0030   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {1 : "new", "2" : "second"} ]
+0033   OP_CONSTANT [6] 1
+           stackframe: [ <closure <script>> ][ {1 : "new", "2" : "second"} ][ 1 ]
+0035   OP_CONSTANT [7] 2
+           stackframe: [ <closure <script>> ][ {1 : "new", "2" : "second"} ][ 1 ][ 2 ]
+0037   OP_CONSTANT [8] 3
+           stackframe: [ <closure <script>> ][ {1 : "new", "2" : "second"} ][ 1 ][ 2 ][ 3 ]
+0039   OP_ARRAY size: 3
+allocate: 40
+allocate: 48
+           stackframe: [ <closure <script>> ][ {1 : "new", "2" : "second"} ][ [1, 2, 3] ]
+0041   OP_CONSTANT [9] 123
+           stackframe: [ <closure <script>> ][ {1 : "new", "2" : "second"} ][ [1, 2, 3] ][ 123 ]
+0043   OP_SET_ELEMENT
+allocate: 48
+           stackframe: [ <closure <script>> ][ 123 ]
+0044   OP_POP
+           stackframe: [ <closure <script>> ]
+0045   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ {1 : "new", "2" : "second", [1, 2, 3] : 123} ]
+0048   OP_PRINT
+{1 : "new", "2" : "second", [1, 2, 3] : 123}
+           stackframe: [ <closure <script>> ]
+0049   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0050   OP_RETURN
@@ -1,186 +1,204 @@
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 96
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 192
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
 allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
 allocate: 56
-allocate: 136
-allocate: 80
-allocate: 40
 allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
 allocate: 32
+allocate: 4
+allocate: 16
 allocate: 64
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 128
 allocate: 128
+allocate: 64
+allocate: 256
 allocate: 256
+allocate: 128
+allocate: 512
+allocate: 512
+allocate: 128
 allocate: 512
-allocate: 1024
 === <script> ===
-allocate: 80
-allocate: 160
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
            stackframe: [ <closure <script>> ]
-0000   OP_CONSTANT [1] 1
+0000   OP_CONSTANT [0] 1
            stackframe: [ <closure <script>> ][ 1 ]
-0002   OP_CONSTANT [2] 2
+0002   OP_CONSTANT [1] 2
            stackframe: [ <closure <script>> ][ 1 ][ 2 ]
-0004   OP_CONSTANT [3] 3
+0004   OP_CONSTANT [2] 3
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 3 ]
-0006   OP_CONSTANT [4] 4
+0006   OP_CONSTANT [3] 4
            stackframe: [ <closure <script>> ][ 1 ][ 2 ][ 3 ][ 4 ]
 0008   OP_ARRAY size: 4
-allocate: 72
+allocate: 40
 allocate: 64
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ]
-0010   OP_DEFINE_GLOBAL [0] "list"
-allocate: 56
+0010   OP_DEFINE_GLOBAL [9] 
            stackframe: [ <closure <script>> ]
-0012   OP_GET_GLOBAL [5] "list"
+0013   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ]
-0014   OP_PRINT
+0016   OP_PRINT
 [1, 2, 3, 4]
            stackframe: [ <closure <script>> ]
-0015   OP_GET_GLOBAL [6] "list"
+0017   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ]
-0017   OP_CONSTANT [7] 0
+0020   OP_CONSTANT [4] 0
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ][ 0 ]
-0019   OP_GET_GLOBAL [8] "list"
+0022   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ][ 0 ][ [1, 2, 3, 4] ]
-0021   OP_CONSTANT [9] 0
+0025   OP_CONSTANT [5] 0
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ][ 0 ][ [1, 2, 3, 4] ][ 0 ]
-0023   OP_GET_ELEMENT
+0027   OP_GET_ELEMENT
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ][ 0 ][ 1 ]
-0024   OP_CONSTANT [10] 1
+0028   OP_CONSTANT [6] 1
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ][ 0 ][ 1 ][ 1 ]
-0026   OP_ADD
+0030   OP_ADD
            stackframe: [ <closure <script>> ][ [1, 2, 3, 4] ][ 0 ][ 2 ]
-0027   OP_SET_ELEMENT
+0031   OP_SET_ELEMENT
            stackframe: [ <closure <script>> ][ 2 ]
-0028   OP_POP
+0032   OP_POP
            stackframe: [ <closure <script>> ]
-0029   OP_GET_GLOBAL [11] "list"
+0033   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [2, 2, 3, 4] ]
-0031   OP_PRINT
+0036   OP_PRINT
 [2, 2, 3, 4]
            stackframe: [ <closure <script>> ]
-0032   OP_GET_GLOBAL [12] "insert"
+0037   OP_GET_GLOBAL [1] 
            stackframe: [ <closure <script>> ][ <native insert> ]
-0034   OP_GET_GLOBAL [13] "list"
+0040   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <native insert> ][ [2, 2, 3, 4] ]
-0036   OP_CONSTANT [14] 0
+0043   OP_CONSTANT [7] 0
            stackframe: [ <closure <script>> ][ <native insert> ][ [2, 2, 3, 4] ][ 0 ]
-0038   OP_CONSTANT [15] 5
+0045   OP_CONSTANT [8] 5
            stackframe: [ <closure <script>> ][ <native insert> ][ [2, 2, 3, 4] ][ 0 ][ 5 ]
-0040   OP_CALL [3] 
+0047   OP_CALL [3] 
 allocate: 128
            stackframe: [ <closure <script>> ][ nil ]
-0042   OP_POP
+0049   OP_POP
            stackframe: [ <closure <script>> ]
-0043   OP_GET_GLOBAL [16] "list"
+0050   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [5, 2, 2, 3, 4] ]
-0045   OP_PRINT
+0053   OP_PRINT
 [5, 2, 2, 3, 4]
            stackframe: [ <closure <script>> ]
-0046   OP_GET_GLOBAL [17] "pop"
+0054   OP_GET_GLOBAL [4] 
            stackframe: [ <closure <script>> ][ <native pop> ]
-0048   OP_GET_GLOBAL [18] "list"
+0057   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <native pop> ][ [5, 2, 2, 3, 4] ]
-0050   OP_CALL [1] 
+0060   OP_CALL [1] 
            stackframe: [ <closure <script>> ][ 4 ]
-0052   OP_POP
+0062   OP_POP
            stackframe: [ <closure <script>> ]
-0053   OP_GET_GLOBAL [19] "list"
+0063   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [5, 2, 2, 3] ]
-0055   OP_PRINT
+0066   OP_PRINT
 [5, 2, 2, 3]
            stackframe: [ <closure <script>> ]
-0056   OP_GET_GLOBAL [20] "list"
+0067   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [5, 2, 2, 3] ]
-0058   OP_CONSTANT [21] 0
+0070   OP_CONSTANT [9] 0
            stackframe: [ <closure <script>> ][ [5, 2, 2, 3] ][ 0 ]
-0060   OP_CONSTANT [22] 1
+0072   OP_CONSTANT [10] 1
            stackframe: [ <closure <script>> ][ [5, 2, 2, 3] ][ 0 ][ 1 ]
-0062   OP_CONSTANT [23] 2
+0074   OP_CONSTANT [11] 2
            stackframe: [ <closure <script>> ][ [5, 2, 2, 3] ][ 0 ][ 1 ][ 2 ]
-0064   OP_ARRAY size: 2
-allocate: 72
+0076   OP_ARRAY size: 2
+allocate: 40
 allocate: 32
            stackframe: [ <closure <script>> ][ [5, 2, 2, 3] ][ 0 ][ [1, 2] ]
-0066   OP_SET_ELEMENT
+0078   OP_SET_ELEMENT
            stackframe: [ <closure <script>> ][ [1, 2] ]
-0067   OP_POP
+0079   OP_POP
            stackframe: [ <closure <script>> ]
-0068   OP_GET_GLOBAL [24] "list"
+0080   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [[1, 2], 2, 2, 3] ]
-0070   OP_PRINT
+0083   OP_PRINT
 [[1, 2], 2, 2, 3]
            stackframe: [ <closure <script>> ]
-0071   OP_GET_GLOBAL [25] "list"
+0084   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [[1, 2], 2, 2, 3] ]
-0073   OP_CONSTANT [26] 0
+0087   OP_CONSTANT [12] 0
            stackframe: [ <closure <script>> ][ [[1, 2], 2, 2, 3] ][ 0 ]
-0075   OP_GET_ELEMENT
+0089   OP_GET_ELEMENT
            stackframe: [ <closure <script>> ][ [1, 2] ]
-0076   OP_CONSTANT [27] 0
+0090   OP_CONSTANT [13] 0
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ]
-0078   OP_GET_ELEMENT
+0092   OP_GET_ELEMENT
            stackframe: [ <closure <script>> ][ 1 ]
-0079   OP_PRINT
+0093   OP_PRINT
 1
            stackframe: [ <closure <script>> ]
-0080   OP_GET_GLOBAL [28] "list"
+0094   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [[1, 2], 2, 2, 3] ]
-0082   OP_CONSTANT [29] 0
+0097   OP_CONSTANT [14] 0
            stackframe: [ <closure <script>> ][ [[1, 2], 2, 2, 3] ][ 0 ]
-0084   OP_GET_ELEMENT
+0099   OP_GET_ELEMENT
            stackframe: [ <closure <script>> ][ [1, 2] ]
-0085   OP_CONSTANT [30] 0
+0100   OP_CONSTANT [15] 0
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ]
-0087   OP_GET_GLOBAL [31] "list"
+0102   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ][ [[1, 2], 2, 2, 3] ]
-0089   OP_CONSTANT [32] 0
+0105   OP_CONSTANT [16] 0
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ][ [[1, 2], 2, 2, 3] ][ 0 ]
-0091   OP_GET_ELEMENT
+0107   OP_GET_ELEMENT
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ][ [1, 2] ]
-0092   OP_CONSTANT [33] 0
+0108   OP_CONSTANT [17] 0
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ][ [1, 2] ][ 0 ]
-0094   OP_GET_ELEMENT
+0110   OP_GET_ELEMENT
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ][ 1 ]
-0095   OP_CONSTANT [34] 1
+0111   OP_CONSTANT [18] 1
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ][ 1 ][ 1 ]
-0097   OP_ADD
+0113   OP_ADD
            stackframe: [ <closure <script>> ][ [1, 2] ][ 0 ][ 2 ]
-0098   OP_SET_ELEMENT
+0114   OP_SET_ELEMENT
            stackframe: [ <closure <script>> ][ 2 ]
-0099   OP_POP
+0115   OP_POP
            stackframe: [ <closure <script>> ]
-0100   OP_GET_GLOBAL [35] "list"
+0116   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ [[2, 2], 2, 2, 3] ]
-0102   OP_CONSTANT [36] 0
+0119   OP_CONSTANT [19] 0
            stackframe: [ <closure <script>> ][ [[2, 2], 2, 2, 3] ][ 0 ]
-0104   OP_GET_ELEMENT
+0121   OP_GET_ELEMENT
            stackframe: [ <closure <script>> ][ [2, 2] ]
-0105   OP_CONSTANT [37] 0
+0122   OP_CONSTANT [20] 0
            stackframe: [ <closure <script>> ][ [2, 2] ][ 0 ]
-0107   OP_GET_ELEMENT
+0124   OP_GET_ELEMENT
            stackframe: [ <closure <script>> ][ 2 ]
-0108   OP_PRINT
+0125   OP_PRINT
 2
            stackframe: [ <closure <script>> ]
-0109   OP_NIL
+0126   OP_NIL
            stackframe: [ <closure <script>> ][ nil ]
-0110   OP_RETURN
+0127   OP_RETURN
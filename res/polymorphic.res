@@ -0,0 +1,693 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 32
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
+=== "name"===
+allocate: 64
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 256
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 32
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 72
+allocate: 13
+allocate: 52
+=== "hi"===
+allocate: 128
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
+=== "name"===
+allocate: 64
+allocate: 256
+allocate: 256
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 72
+allocate: 56
+allocate: 32
+allocate: 15
+allocate: 60
+=== "hi"===
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
+=== "name"===
+allocate: 128
+allocate: 512
+allocate: 56
+allocate: 768
+allocate: 56
+allocate: 256
+allocate: 1024
+allocate: 512
+allocate: 72
+allocate: 56
+allocate: 56
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
+=== "shadow"===
+allocate: 16
+allocate: 144
+allocate: 288
+allocate: 208
+allocate: 832
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CLASS [0] "A"
+allocate: 72
+allocate: 80
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0008   OP_CLOSURE [2] <fn "name">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <closure <fn "name">> ]
+0010   OP_METHOD [1] "name"
+allocate: 192
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0012   OP_CLOSURE [4] <fn "hi">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <closure <fn "hi">> ]
+0014   OP_METHOD [3] "hi"
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0016   OP_POP
+           stackframe: [ <closure <script>> ]
+0017   OP_CLASS [5] "B"
+allocate: 72
+allocate: 80
+           stackframe: [ <closure <script>> ][ <class "B"> ]
+0019   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0022   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0025   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "B"> ]
+0028   OP_INHERIT
+allocate: 192
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0029   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "B"> ]
+0032   OP_CLOSURE [7] <fn "name">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "B"> ][ <closure <fn "name">> ]
+0034   OP_METHOD [6] "name"
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "B"> ]
+0036   OP_CLOSURE [9] <fn "hi">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "B"> ][ <closure <fn "hi">> ]
+0040   OP_METHOD [8] "hi"
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "B"> ]
+0042   OP_POP
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0043   OP_CLOSE_UPVALUE
+           stackframe: [ <closure <script>> ]
+0044   OP_CLASS [10] "C"
+allocate: 72
+allocate: 80
+           stackframe: [ <closure <script>> ][ <class "C"> ]
+0046   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0049   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0052   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "C"> ]
+0055   OP_INHERIT
+allocate: 192
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0056   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "C"> ]
+0059   OP_CLOSURE [12] <fn "name">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "C"> ][ <closure <fn "name">> ]
+0061   OP_METHOD [11] "name"
+           stackframe: [ <closure <script>> ][ <class "A"> ][ <class "C"> ]
+0063   OP_POP
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0064   OP_CLOSE_UPVALUE
+           stackframe: [ <closure <script>> ]
+0065   OP_CLASS [13] "D"
+allocate: 72
+allocate: 80
+           stackframe: [ <closure <script>> ][ <class "D"> ]
+0067   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0070   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <class "B"> ]
+0073   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <class "B"> ][ <class "D"> ]
+0076   OP_INHERIT
+allocate: 192
+           stackframe: [ <closure <script>> ][ <class "B"> ]
+0077   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <class "B"> ][ <class "D"> ]
+0080   OP_POP
+           stackframe: [ <closure <script>> ][ <class "B"> ]
+0081   OP_CLOSE_UPVALUE
+           stackframe: [ <closure <script>> ]
+0082   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0085   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ]
+0087   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <class "B"> ]
+0090   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ]
+0092   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <class "C"> ]
+0095   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ]
+0097   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <class "D"> ]
+0100   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ]
+0102   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ][ <class "A"> ]
+0105   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ][ <instance <class "A">> ]
+0107   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ][ <instance <class "A">> ][ <class "B"> ]
+0110   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ][ <instance <class "A">> ][ <instance <class "B">> ]
+0112   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ][ <instance <class "A">> ][ <instance <class "B">> ][ <class "C"> ]
+0115   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ]
+0117   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <class "D"> ]
+0120   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ][ <instance <class "A">> ][ <instance <class "B">> ][ <instance <class "C">> ][ <instance <class "D">> ]
+0122   OP_ARRAY size: 8
+allocate: 40
+allocate: 128
+           stackframe: [ <closure <script>> ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0124   OP_DEFINE_GLOBAL [13] 
+           stackframe: [ <closure <script>> ]
+0127   OP_CONSTANT [14] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 0 ]
+0134 OP_JUMP          134  -> 148
+           stackframe: [ <closure <script>> ][ 0 ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 0 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0151   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 0 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ][ 0 ]
+0153   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 0 ][ <instance <class "A">> ]
+0154   OP_INVOKE(args: 0) [17] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 0 ][ <instance <class "A">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ 0 ][ <instance <class "A">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 0 ][ <instance <class "A">> ][ "hi " ][ <instance <class "A">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+           stackframe: [ <closure <script>> ][ 0 ][ <instance <class "A">> ][ "hi " ][ <instance <class "A">> ]
+0000   OP_CONSTANT [0] "A"
+           stackframe: [ <closure <script>> ][ 0 ][ <instance <class "A">> ][ "hi " ][ <instance <class "A">> ][ "A" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ 0 ][ <instance <class "A">> ][ "hi " ][ "A" ]
+0009   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ 0 ][ <instance <class "A">> ][ "hi A" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ 0 ][ "hi A" ]
+0159   OP_PRINT
+"hi A"
+           stackframe: [ <closure <script>> ][ 0 ]
+0160 OP_LOOP          160  -> 137
+           stackframe: [ <closure <script>> ][ 0 ]
+0137   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 1 ]
+0134 OP_JUMP          134  -> 148
+           stackframe: [ <closure <script>> ][ 1 ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 1 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0151   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 1 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ][ 1 ]
+0153   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ]
+0154   OP_INVOKE(args: 0) [17] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ]
+0000   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ]
+0002   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ][ <class "A"> ]
+0004   OP_SUPER_INVOKE(args: 0) [0] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ][ <instance <class "B">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ][ <instance <class "B">> ]
+0000   OP_CONSTANT [0] "B"
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ][ <instance <class "B">> ][ "B" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ][ "B" ]
+0009   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi B" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ "hi B" ]
+0009   OP_CONSTANT [1] "!"
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ "hi B" ][ "!" ]
+0011   OP_ADD
+allocate: 56
+allocate: 512
+           stackframe: [ <closure <script>> ][ 1 ][ <instance <class "B">> ][ "hi B!" ]
+0012   OP_RETURN
+           stackframe: [ <closure <script>> ][ 1 ][ "hi B!" ]
+0159   OP_PRINT
+"hi B!"
+           stackframe: [ <closure <script>> ][ 1 ]
+0160 OP_LOOP          160  -> 137
+           stackframe: [ <closure <script>> ][ 1 ]
+0137   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 2 ]
+0134 OP_JUMP          134  -> 148
+           stackframe: [ <closure <script>> ][ 2 ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 2 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0151   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 2 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ][ 2 ]
+0153   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 2 ][ <instance <class "C">> ]
+0154   OP_INVOKE(args: 0) [17] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 2 ][ <instance <class "C">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ 2 ][ <instance <class "C">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 2 ][ <instance <class "C">> ][ "hi " ][ <instance <class "C">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+gc collect 168 bytes
+           stackframe: [ <closure <script>> ][ 2 ][ <instance <class "C">> ][ "hi " ][ <instance <class "C">> ]
+0000   OP_CONSTANT [0] "C"
+           stackframe: [ <closure <script>> ][ 2 ][ <instance <class "C">> ][ "hi " ][ <instance <class "C">> ][ "C" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ 2 ][ <instance <class "C">> ][ "hi " ][ "C" ]
+0009   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ 2 ][ <instance <class "C">> ][ "hi C" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ 2 ][ "hi C" ]
+0159   OP_PRINT
+"hi C"
+           stackframe: [ <closure <script>> ][ 2 ]
+0160 OP_LOOP          160  -> 137
+           stackframe: [ <closure <script>> ][ 2 ]
+0137   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 3 ]
+0134 OP_JUMP          134  -> 148
+           stackframe: [ <closure <script>> ][ 3 ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 3 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0151   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 3 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ][ 3 ]
+0153   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ]
+0154   OP_INVOKE(args: 0) [17] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ]
+0000   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ]
+0002   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ][ <class "A"> ]
+0004   OP_SUPER_INVOKE(args: 0) [0] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ][ <instance <class "D">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ][ <instance <class "D">> ]
+0000   OP_CONSTANT [0] "B"
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ][ <instance <class "D">> ][ "B" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ][ "B" ]
+0009   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi B" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ "hi B" ]
+0009   OP_CONSTANT [1] "!"
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ "hi B" ][ "!" ]
+0011   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ 3 ][ <instance <class "D">> ][ "hi B!" ]
+0012   OP_RETURN
+           stackframe: [ <closure <script>> ][ 3 ][ "hi B!" ]
+0159   OP_PRINT
+"hi B!"
+           stackframe: [ <closure <script>> ][ 3 ]
+0160 OP_LOOP          160  -> 137
+           stackframe: [ <closure <script>> ][ 3 ]
+0137   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 4 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 4 ]
+0134 OP_JUMP          134  -> 148
+           stackframe: [ <closure <script>> ][ 4 ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 4 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0151   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 4 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ][ 4 ]
+0153   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 4 ][ <instance <class "A">> ]
+0154   OP_INVOKE(args: 0) [17] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 4 ][ <instance <class "A">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ 4 ][ <instance <class "A">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 4 ][ <instance <class "A">> ][ "hi " ][ <instance <class "A">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+           stackframe: [ <closure <script>> ][ 4 ][ <instance <class "A">> ][ "hi " ][ <instance <class "A">> ]
+0000   OP_CONSTANT [0] "A"
+           stackframe: [ <closure <script>> ][ 4 ][ <instance <class "A">> ][ "hi " ][ <instance <class "A">> ][ "A" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ 4 ][ <instance <class "A">> ][ "hi " ][ "A" ]
+0009   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ 4 ][ <instance <class "A">> ][ "hi A" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ 4 ][ "hi A" ]
+0159   OP_PRINT
+"hi A"
+           stackframe: [ <closure <script>> ][ 4 ]
+0160 OP_LOOP          160  -> 137
+           stackframe: [ <closure <script>> ][ 4 ]
+0137   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 5 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 5 ]
+0134 OP_JUMP          134  -> 148
+           stackframe: [ <closure <script>> ][ 5 ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 5 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0151   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 5 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ][ 5 ]
+0153   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ]
+0154   OP_INVOKE(args: 0) [17] "hi" cache 0
+gc collect 224 bytes
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ]
+0000   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ]
+0002   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ][ <class "A"> ]
+0004   OP_SUPER_INVOKE(args: 0) [0] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ][ <instance <class "B">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ][ <instance <class "B">> ]
+0000   OP_CONSTANT [0] "B"
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ][ <instance <class "B">> ][ "B" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi " ][ "B" ]
+0009   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ <instance <class "B">> ][ "hi B" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ "hi B" ]
+0009   OP_CONSTANT [1] "!"
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ "hi B" ][ "!" ]
+0011   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ 5 ][ <instance <class "B">> ][ "hi B!" ]
+0012   OP_RETURN
+           stackframe: [ <closure <script>> ][ 5 ][ "hi B!" ]
+0159   OP_PRINT
+"hi B!"
+           stackframe: [ <closure <script>> ][ 5 ]
+0160 OP_LOOP          160  -> 137
+           stackframe: [ <closure <script>> ][ 5 ]
+0137   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 6 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 6 ]
+0134 OP_JUMP          134  -> 148
+           stackframe: [ <closure <script>> ][ 6 ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 6 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0151   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 6 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ][ 6 ]
+0153   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 6 ][ <instance <class "C">> ]
+0154   OP_INVOKE(args: 0) [17] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 6 ][ <instance <class "C">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ 6 ][ <instance <class "C">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 6 ][ <instance <class "C">> ][ "hi " ][ <instance <class "C">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+           stackframe: [ <closure <script>> ][ 6 ][ <instance <class "C">> ][ "hi " ][ <instance <class "C">> ]
+0000   OP_CONSTANT [0] "C"
+           stackframe: [ <closure <script>> ][ 6 ][ <instance <class "C">> ][ "hi " ][ <instance <class "C">> ][ "C" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ 6 ][ <instance <class "C">> ][ "hi " ][ "C" ]
+0009   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ 6 ][ <instance <class "C">> ][ "hi C" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ 6 ][ "hi C" ]
+0159   OP_PRINT
+"hi C"
+           stackframe: [ <closure <script>> ][ 6 ]
+0160 OP_LOOP          160  -> 137
+           stackframe: [ <closure <script>> ][ 6 ]
+0137   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 7 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 7 ]
+0134 OP_JUMP          134  -> 148
+           stackframe: [ <closure <script>> ][ 7 ]
+0148   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ 7 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ]
+0151   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 7 ][ [<instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>, <instance <class "A">>, <instance <class "B">>, <instance <class "C">>, <instance <class "D">>] ][ 7 ]
+0153   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ]
+0154   OP_INVOKE(args: 0) [17] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ]
+0000   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ]
+0002   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ][ <class "A"> ]
+0004   OP_SUPER_INVOKE(args: 0) [0] "hi" cache 0
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ][ <instance <class "D">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ][ <instance <class "D">> ]
+0000   OP_CONSTANT [0] "B"
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ][ <instance <class "D">> ][ "B" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi " ][ "B" ]
+0009   OP_ADD_STR
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ <instance <class "D">> ][ "hi B" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ "hi B" ]
+0009   OP_CONSTANT [1] "!"
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ "hi B" ][ "!" ]
+0011   OP_ADD_STR
+gc collect 112 bytes
+           stackframe: [ <closure <script>> ][ 7 ][ <instance <class "D">> ][ "hi B!" ]
+0012   OP_RETURN
+           stackframe: [ <closure <script>> ][ 7 ][ "hi B!" ]
+0159   OP_PRINT
+"hi B!"
+           stackframe: [ <closure <script>> ][ 7 ]
+0160 OP_LOOP          160  -> 137
+           stackframe: [ <closure <script>> ][ 7 ]
+0137   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 8 ]
+0129 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 8 129  -> 163
+           stackframe: [ <closure <script>> ][ 8 ]
+0163   OP_CLOSE_UPVALUE
+           stackframe: [ <closure <script>> ]
+0164   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <class "A"> ]
+0167   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ]
+0169   OP_DEFINE_GLOBAL [14] 
+           stackframe: [ <closure <script>> ]
+0172   OP_CLOSURE [18] <fn "shadow">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "shadow">> ]
+0174   OP_DEFINE_GLOBAL [15] 
+           stackframe: [ <closure <script>> ]
+0177   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ]
+0180   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ <closure <fn "shadow">> ]
+0183   OP_SET_PROPERTY [19] "name" cache 0
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ <closure <fn "shadow">> ]
+0187   OP_POP
+           stackframe: [ <closure <script>> ]
+0188   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ]
+0191   OP_INVOKE(args: 0) [20] "name" cache 1
+           stackframe: [ <closure <script>> ][ <closure <fn "shadow">> ]
+0000   OP_CONSTANT [0] "field"
+           stackframe: [ <closure <script>> ][ <closure <fn "shadow">> ][ "field" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ "field" ]
+0196   OP_PRINT
+"field"
+           stackframe: [ <closure <script>> ]
+0197   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ]
+0200   OP_INVOKE(args: 0) [21] "hi" cache 2
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ]
+0000   OP_CONSTANT [0] "hi "
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ "hi " ]
+0002   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ "hi " ][ <instance <class "A">> ]
+0004   OP_INVOKE(args: 0) [1] "name" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ "hi " ][ <closure <fn "shadow">> ]
+0000   OP_CONSTANT [0] "field"
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ "hi " ][ <closure <fn "shadow">> ][ "field" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ "hi " ][ "field" ]
+0009   OP_ADD_STR
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "A">> ][ "hi field" ]
+0010   OP_RETURN
+           stackframe: [ <closure <script>> ][ "hi field" ]
+0205   OP_PRINT
+"hi field"
+           stackframe: [ <closure <script>> ]
+0206   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0207   OP_RETURN
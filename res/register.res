@@ -0,0 +1,1092 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 64
+allocate: 256
+allocate: 128
+allocate: 62
+allocate: 248
+=== "arith"===
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 256
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 64
+allocate: 56
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 128
+allocate: 56
+allocate: 56
+allocate: 56
+allocate: 64
+allocate: 256
+allocate: 38
+allocate: 152
+=== "strings"===
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 768
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 32
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 128
+allocate: 512
+allocate: 256
+allocate: 83
+allocate: 332
+=== "order"===
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 16
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 512
+allocate: 56
+allocate: 56
+allocate: 256
+allocate: 128
+allocate: 512
+allocate: 56
+allocate: 56
+allocate: 512
+allocate: 256
+allocate: 1024
+allocate: 148
+allocate: 592
+=== "compare"===
+allocate: 256
+allocate: 128
+allocate: 512
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 38
+allocate: 152
+=== "globals"===
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 18
+allocate: 72
+=== "next"===
+allocate: 32
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 11
+allocate: 44
+=== "counter"===
+allocate: 512
+allocate: 256
+allocate: 1024
+allocate: 135
+allocate: 540
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CONSTANT [0] 10
+           stackframe: [ <closure <script>> ][ 10 ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_CLOSURE [1] <fn "arith">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ]
+0007   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0010   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ]
+0013   OP_CONSTANT [2] 7
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ]
+0015   OP_CONSTANT [3] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ]
+0017   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ]
+0000   OP_MUL_REG_CONST [3] [2] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 6 ]
+0004   OP_ADD_REG_REG [3] [1] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 13 ]
+0008   OP_SUB_REG_REG [4] [1] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 13 ][ 4 ]
+0012   OP_DIV_REG_CONST [4] [4] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 13 ][ 2 ]
+0016   OP_MUL_REG_REG [3] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ 2 ]
+0020   OP_NEGATE_REG [4] [4]
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ]
+0023   OP_GET_LOCAL [3] 
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ 169 ]
+0025   OP_PRINT
+169
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ]
+0026   OP_GET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ -2 ]
+0028   OP_PRINT
+-2
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ]
+0029   OP_LOAD_CONST [5] 100
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ 100 ]
+0032   OP_SUB_REG_REG [5] [5] [1]
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ 93 ]
+0036   OP_PRINT
+93
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ]
+0037   OP_MUL_REG_CONST [5] [1] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ 21 ]
+0041   OP_PRINT
+21
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ]
+0042   OP_DIV_REG_CONST [5] [1] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ 7 ]
+0046   OP_ADD_REG_REG [5] [5] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ 10 ]
+0050   OP_PRINT
+10
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ]
+0051   OP_MUL_REG_CONST [5] [4] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ -4 ]
+0055   OP_SUB_REG_REG [5] [3] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "arith">> ][ 7 ][ 3 ][ 169 ][ -2 ][ 173 ]
+0059   OP_RETURN
+           stackframe: [ <closure <script>> ][ 173 ]
+0019   OP_PRINT
+173
+           stackframe: [ <closure <script>> ]
+0020   OP_CLOSURE [4] <fn "strings">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ]
+0022   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0025   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ]
+0028   OP_CONSTANT [5] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ]
+0030   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ]
+0000   OP_LOAD_CONST [2] "n="
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=" ]
+0003   OP_ADD_REG_REG [2] [2] [1]
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1" ]
+0007   OP_ADD_REG_CONST [2] [2] "!"
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ]
+0011   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ "n=1!" ]
+0013   OP_PRINT
+"n=1!"
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ]
+0014   OP_CONSTANT [2] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ 1 ]
+0016   OP_CONSTANT [3] "x"
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ 1 ][ "x" ]
+0018   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ "1x" ]
+0019   OP_PRINT
+"1x"
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ]
+0020   OP_CONSTANT [4] "a"
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ "a" ]
+0022   OP_CONSTANT [5] "b"
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ "a" ][ "b" ]
+0024   OP_ADD
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ "ab" ]
+0025   OP_EQUAL_REG_CONST [3] [3] "ab"
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ true ]
+0029   OP_PRINT
+true
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ]
+0030   OP_EQUAL_REG_CONST [3] [2] "n=1!"
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ true ]
+0034   OP_NOT
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ false ]
+0035   OP_PRINT
+false
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ]
+0036   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "strings">> ][ 1 ][ "n=1!" ][ nil ]
+0037   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0032   OP_POP
+           stackframe: [ <closure <script>> ]
+0033   OP_CLOSURE [6] <fn "order">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ]
+0035   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0038   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ]
+0041   OP_CONSTANT [7] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 1 ]
+0043   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 1 ]
+0000   OP_CONSTANT [0] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 1 ][ 1 ]
+0002   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 1 ][ 1 ][ 1 ]
+0004   OP_LOAD_CONST [1] 5
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 1 ][ 1 ]
+0007   OP_ADD_REG_REG [3] [3] [1]
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 1 ][ 6 ]
+0011   OP_PRINT
+6
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 1 ]
+0012   OP_LOAD_CONST [2] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 2 ]
+0015   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 2 ][ 2 ]
+0017   OP_LOAD_CONST [2] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ 2 ]
+0020   OP_ADD_REG_REG [3] [3] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ 5 ]
+0024   OP_ADD_REG_REG [3] [3] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ 8 ]
+0028   OP_PRINT
+8
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ]
+0029   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ 5 ][ 5 ]
+0033   OP_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ true ]
+0034 OP_JUMP_IF_FALSE 34   -> 43
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ true ]
+0037   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ 3 ]
+0040   OP_CONSTANT [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ 3 ][ 3 ]
+0042   OP_EQUAL
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ][ true ]
+0043   OP_PRINT
+true
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 3 ]
+0044   OP_LOAD_CONST [2] 7
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 5 ][ 7 ]
+0047   OP_MOVE_REG [1] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ]
+0050   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ]
+0052   OP_ADD_REG_REG [4] [1] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ 14 ]
+0056   OP_ADD_REG_REG [4] [4] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ 21 ]
+0060   OP_PRINT
+21
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ]
+0061   OP_NOT_REG [4] [1]
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ false ]
+0064   OP_PRINT
+false
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ]
+0065   OP_LESS_REG_REG [4] [1] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ false ]
+0069   OP_NOT
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ true ]
+0070   OP_PRINT
+true
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ]
+0071   OP_ADD_REG_CONST [4] [1] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ 8 ]
+0075   OP_MUL_REG_CONST [4] [4] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ 16 ]
+0079   OP_NEGATE
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ -16 ]
+0080   OP_PRINT
+-16
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ]
+0081   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "order">> ][ 7 ][ 7 ][ 7 ][ nil ]
+0082   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0045   OP_POP
+           stackframe: [ <closure <script>> ]
+0046   OP_CLOSURE [8] <fn "compare">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ]
+0048   OP_DEFINE_GLOBAL [13] 
+           stackframe: [ <closure <script>> ]
+0051   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ]
+0054   OP_CONSTANT [9] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ]
+0056   OP_CONSTANT [10] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0058   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0000 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [1] [2] 0    -> 11
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0005   OP_CONSTANT [0] "lt"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ "lt" ]
+0007   OP_PRINT
+"lt"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0008 OP_JUMP          8    -> 14
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0014 OP_JUMP_IF_LESS_LOCAL_LOCAL [1] [2] 14   -> 25
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0025   OP_CONSTANT [3] "lt"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ "lt" ]
+0027   OP_PRINT
+"lt"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0028 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [1] 2 28   -> 39
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0039   OP_CONSTANT [6] "2 >= a"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ "2 >= a" ]
+0041   OP_PRINT
+"2 >= a"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0042   OP_ADD_REG_CONST [3] [1] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 2 ]
+0046   OP_EQUAL_REG_REG [3] [3] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ true ]
+0050 OP_JUMP_IF_FALSE 50   -> 60
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ true ]
+0053   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0054   OP_CONSTANT [8] "next"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ "next" ]
+0056   OP_PRINT
+"next"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0057 OP_JUMP          57   -> 61
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0061   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ nil ]
+0062   OP_EQUAL_REG_REG [3] [1] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ false ]
+0066 OP_JUMP_IF_FALSE 66   -> 76
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ false ]
+0076   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 1 ]
+0079 OP_JUMP_IF_FALSE 79   -> 89
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 1 ]
+0082   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0083   OP_CONSTANT [10] "truthy"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ "truthy" ]
+0085   OP_PRINT
+"truthy"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0086 OP_JUMP          86   -> 90
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ]
+0090   OP_CONSTANT [11] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 0 ]
+0092   OP_CONSTANT [12] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 0 ][ 0 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 0 ][ 0 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 0 ][ 0 ][ 0 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 0 ][ 0 ][ 0 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 0 ][ 0 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 1 ][ 0 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 1 ][ 0 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 1 ][ 0 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 1 ][ 0 ][ 1 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 1 ][ 1 ][ 1 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 1 ][ 1 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 2 ][ 1 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 2 ][ 1 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 2 ][ 1 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 2 ][ 1 ][ 4 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 2 ][ 5 ][ 4 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 2 ][ 5 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 3 ][ 5 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 3 ][ 5 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 3 ][ 5 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 3 ][ 5 ][ 9 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 3 ][ 14 ][ 9 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 3 ][ 14 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 4 ][ 14 ]
+0112 OP_LOOP          112  -> 94
+gc collect 112 bytes
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 4 ][ 14 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 4 ][ 14 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 4 ][ 14 ][ 16 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 4 ][ 30 ][ 16 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 4 ][ 30 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 5 ][ 30 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 5 ][ 30 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 5 ][ 30 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 5 ][ 30 ][ 25 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 5 ][ 55 ][ 25 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 5 ][ 55 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 6 ][ 55 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 6 ][ 55 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 6 ][ 55 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 6 ][ 55 ][ 36 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 6 ][ 91 ][ 36 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 6 ][ 91 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 7 ][ 91 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 7 ][ 91 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 7 ][ 91 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 7 ][ 91 ][ 49 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 7 ][ 140 ][ 49 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 7 ][ 140 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 8 ][ 140 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 8 ][ 140 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 8 ][ 140 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 8 ][ 140 ][ 64 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 8 ][ 204 ][ 64 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 8 ][ 204 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 9 ][ 204 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 9 ][ 204 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 9 ][ 204 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 9 ][ 204 ][ 81 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 9 ][ 285 ][ 81 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 9 ][ 285 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 285 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 285 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 285 ]
+0115   OP_GET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 285 ][ 285 ]
+0117   OP_PRINT
+285
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 285 ]
+0118   OP_CONSTANT [15] 10
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 285 ][ 10 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 285 ][ 10 ]
+0125 OP_JUMP          125  -> 135
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 285 ][ 10 ]
+0135   OP_SUB_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 275 ][ 10 ]
+0139 OP_LOOP          139  -> 128
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 275 ][ 10 ]
+0128   OP_SUB_REG_CONST [5] [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 275 ][ 7 ]
+0132 OP_LOOP          132  -> 120
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 275 ][ 7 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 275 ][ 7 ]
+0125 OP_JUMP          125  -> 135
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 275 ][ 7 ]
+0135   OP_SUB_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 268 ][ 7 ]
+0139 OP_LOOP          139  -> 128
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 268 ][ 7 ]
+0128   OP_SUB_REG_CONST [5] [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 268 ][ 4 ]
+0132 OP_LOOP          132  -> 120
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 268 ][ 4 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 268 ][ 4 ]
+0125 OP_JUMP          125  -> 135
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 268 ][ 4 ]
+0135   OP_SUB_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 264 ][ 4 ]
+0139 OP_LOOP          139  -> 128
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 264 ][ 4 ]
+0128   OP_SUB_REG_CONST [5] [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 264 ][ 1 ]
+0132 OP_LOOP          132  -> 120
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 264 ][ 1 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 264 ][ 1 ]
+0125 OP_JUMP          125  -> 135
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 264 ][ 1 ]
+0135   OP_SUB_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 263 ][ 1 ]
+0139 OP_LOOP          139  -> 128
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 263 ][ 1 ]
+0128   OP_SUB_REG_CONST [5] [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 263 ][ -2 ]
+0132 OP_LOOP          132  -> 120
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 263 ][ -2 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 263 ][ -2 ]
+0142   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 263 ][ 263 ]
+0145   OP_PRINT
+263
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 263 ]
+0146   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 1 ][ 2 ][ 10 ][ 263 ][ nil ]
+0147   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0060   OP_POP
+           stackframe: [ <closure <script>> ]
+0061   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ]
+0064   OP_CONSTANT [11] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ]
+0066   OP_CONSTANT [12] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0068   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0000 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [1] [2] 0    -> 11
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0011   OP_CONSTANT [1] "ge"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ "ge" ]
+0013   OP_PRINT
+"ge"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0014 OP_JUMP_IF_LESS_LOCAL_LOCAL [1] [2] 14   -> 25
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0019   OP_CONSTANT [2] "ge"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ "ge" ]
+0021   OP_PRINT
+"ge"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0022 OP_JUMP          22   -> 28
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0028 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [1] 2 28   -> 39
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0033   OP_CONSTANT [5] "2 < a"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ "2 < a" ]
+0035   OP_PRINT
+"2 < a"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0036 OP_JUMP          36   -> 42
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0042   OP_ADD_REG_CONST [3] [1] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 4 ]
+0046   OP_EQUAL_REG_REG [3] [3] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ false ]
+0050 OP_JUMP_IF_FALSE 50   -> 60
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ false ]
+0060   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0061   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ nil ]
+0062   OP_EQUAL_REG_REG [3] [1] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ false ]
+0066 OP_JUMP_IF_FALSE 66   -> 76
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ false ]
+0076   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 3 ]
+0079 OP_JUMP_IF_FALSE 79   -> 89
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 3 ]
+0082   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0083   OP_CONSTANT [10] "truthy"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ "truthy" ]
+0085   OP_PRINT
+"truthy"
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0086 OP_JUMP          86   -> 90
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ]
+0090   OP_CONSTANT [11] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 0 ]
+0092   OP_CONSTANT [12] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 0 ][ 0 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 0 ][ 0 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 0 ][ 0 ][ 0 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 0 ][ 0 ][ 0 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 0 ][ 0 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 1 ][ 0 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 1 ][ 0 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 1 ][ 0 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 1 ][ 0 ][ 1 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 1 ][ 1 ][ 1 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 1 ][ 1 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 2 ][ 1 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 2 ][ 1 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 2 ][ 1 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 2 ][ 1 ][ 4 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 2 ][ 5 ][ 4 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 2 ][ 5 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 3 ][ 5 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 3 ][ 5 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 3 ][ 5 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 3 ][ 5 ][ 9 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 3 ][ 14 ][ 9 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 3 ][ 14 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 4 ][ 14 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 4 ][ 14 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 4 ][ 14 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 4 ][ 14 ][ 16 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 4 ][ 30 ][ 16 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 4 ][ 30 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 5 ][ 30 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 5 ][ 30 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 5 ][ 30 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 5 ][ 30 ][ 25 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 5 ][ 55 ][ 25 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 5 ][ 55 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 6 ][ 55 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 6 ][ 55 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 6 ][ 55 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 6 ][ 55 ][ 36 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 6 ][ 91 ][ 36 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 6 ][ 91 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 7 ][ 91 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 7 ][ 91 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 7 ][ 91 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 7 ][ 91 ][ 49 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 7 ][ 140 ][ 49 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 7 ][ 140 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 8 ][ 140 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 8 ][ 140 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 8 ][ 140 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 8 ][ 140 ][ 64 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 8 ][ 204 ][ 64 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 8 ][ 204 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 9 ][ 204 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 9 ][ 204 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 9 ][ 204 ]
+0099   OP_MUL_REG_REG [5] [3] [3]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 9 ][ 204 ][ 81 ]
+0103   OP_ADD_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 9 ][ 285 ][ 81 ]
+0107   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 9 ][ 285 ]
+0108   OP_ADD_REG_CONST [3] [3] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 285 ]
+0112 OP_LOOP          112  -> 94
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 285 ]
+0094 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [3] 10 94   -> 115
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 285 ]
+0115   OP_GET_LOCAL [4] 
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 285 ][ 285 ]
+0117   OP_PRINT
+285
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 285 ]
+0118   OP_CONSTANT [15] 10
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 285 ][ 10 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 285 ][ 10 ]
+0125 OP_JUMP          125  -> 135
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 285 ][ 10 ]
+0135   OP_SUB_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 275 ][ 10 ]
+0139 OP_LOOP          139  -> 128
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 275 ][ 10 ]
+0128   OP_SUB_REG_CONST [5] [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 275 ][ 7 ]
+0132 OP_LOOP          132  -> 120
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 275 ][ 7 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 275 ][ 7 ]
+0125 OP_JUMP          125  -> 135
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 275 ][ 7 ]
+0135   OP_SUB_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 268 ][ 7 ]
+0139 OP_LOOP          139  -> 128
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 268 ][ 7 ]
+0128   OP_SUB_REG_CONST [5] [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 268 ][ 4 ]
+0132 OP_LOOP          132  -> 120
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 268 ][ 4 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 268 ][ 4 ]
+0125 OP_JUMP          125  -> 135
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 268 ][ 4 ]
+0135   OP_SUB_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 264 ][ 4 ]
+0139 OP_LOOP          139  -> 128
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 264 ][ 4 ]
+0128   OP_SUB_REG_CONST [5] [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 264 ][ 1 ]
+0132 OP_LOOP          132  -> 120
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 264 ][ 1 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 264 ][ 1 ]
+0125 OP_JUMP          125  -> 135
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 264 ][ 1 ]
+0135   OP_SUB_REG_REG [4] [4] [5]
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 263 ][ 1 ]
+0139 OP_LOOP          139  -> 128
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 263 ][ 1 ]
+0128   OP_SUB_REG_CONST [5] [5] 3
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 263 ][ -2 ]
+0132 OP_LOOP          132  -> 120
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 263 ][ -2 ]
+0120 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [5] 0 120  -> 142
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 263 ][ -2 ]
+0142   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 263 ][ 263 ]
+0145   OP_PRINT
+263
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 263 ]
+0146   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "compare">> ][ 3 ][ 1 ][ 10 ][ 263 ][ nil ]
+0147   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0070   OP_POP
+           stackframe: [ <closure <script>> ]
+0071   OP_CLOSURE [13] <fn "globals">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ]
+0073   OP_DEFINE_GLOBAL [14] 
+           stackframe: [ <closure <script>> ]
+0076   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ]
+0079   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ]
+0000   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 10 ]
+0003   OP_ADD_REG_CONST [1] [1] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 11 ]
+0007   OP_SET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 11 ]
+0010   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ]
+0011   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 11 ]
+0014   OP_MUL_REG_CONST [1] [1] 2
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ]
+0018   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ][ 11 ]
+0021   OP_SUB_REG_REG [2] [1] [2]
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ][ 11 ]
+0025   OP_SET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ][ 11 ]
+0028   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ]
+0029   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ][ 11 ]
+0032   OP_PRINT
+11
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ]
+0033   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ][ 22 ]
+0035   OP_PRINT
+22
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ]
+0036   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "globals">> ][ 22 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0081   OP_POP
+           stackframe: [ <closure <script>> ]
+0082   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ 11 ]
+0085   OP_PRINT
+11
+           stackframe: [ <closure <script>> ]
+0086   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ 11 ]
+0089   OP_ADD_REG_CONST [1] [1] 1
+           stackframe: [ <closure <script>> ][ 12 ]
+0093   OP_SET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ 12 ]
+0096   OP_PRINT
+12
+           stackframe: [ <closure <script>> ]
+0097   OP_CLOSURE [15] <fn "counter">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "counter">> ]
+0099   OP_DEFINE_GLOBAL [15] 
+           stackframe: [ <closure <script>> ]
+0102   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ <closure <fn "counter">> ]
+0105   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "counter">> ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 0 ]
+0002   OP_CLOSURE [1] <fn "next">
+allocate: 48
+allocate: 8
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 0 ][ <closure <fn "next">> ]
+0006   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <closure <fn "counter">> ][ 0 ][ <closure <fn "next">> ][ <closure <fn "next">> ]
+0008   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ]
+0107   OP_DEFINE_GLOBAL [16] 
+           stackframe: [ <closure <script>> ]
+0110   OP_GET_GLOBAL [16] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ]
+0113   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 0 ]
+0002   OP_ADD_REG_CONST [1] [1] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 1 ]
+0006   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 1 ]
+0008   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ]
+0009   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 1 ]
+0011   OP_MUL_REG_CONST [1] [1] 10
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 10 ]
+0015   OP_RETURN
+           stackframe: [ <closure <script>> ][ 10 ]
+0115   OP_PRINT
+10
+           stackframe: [ <closure <script>> ]
+0116   OP_GET_GLOBAL [16] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ]
+0119   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ]
+0000   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 1 ]
+0002   OP_ADD_REG_CONST [1] [1] 1
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 2 ]
+0006   OP_SET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 2 ]
+0008   OP_POP
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ]
+0009   OP_GET_UPVALUE [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 2 ]
+0011   OP_MUL_REG_CONST [1] [1] 10
+           stackframe: [ <closure <script>> ][ <closure <fn "next">> ][ 20 ]
+0015   OP_RETURN
+           stackframe: [ <closure <script>> ][ 20 ]
+0121   OP_PRINT
+20
+           stackframe: [ <closure <script>> ]
+0122   OP_CONSTANT [16] "x"
+           stackframe: [ <closure <script>> ][ "x" ]
+0124   OP_LOAD_CONST [2] 1
+           stackframe: [ <closure <script>> ][ "x" ][ 1 ]
+0127   OP_SUB_REG_REG [2] [2] [1]
@@ -0,0 +1,1527 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 64
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 256
+allocate: 43
+allocate: 172
+=== "worker"===
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 3
+allocate: 12
+=== "pass"===
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 56
+allocate: 56
+allocate: 256
+allocate: 56
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 56
+allocate: 32
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 9
+allocate: 36
+=== "inner"===
+allocate: 128
+allocate: 512
+allocate: 56
+allocate: 768
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 16
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 512
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 19
+allocate: 76
+=== "outer"===
+allocate: 56
+allocate: 56
+allocate: 31
+allocate: 56
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 64
+allocate: 256
+allocate: 38
+allocate: 152
+=== "count"===
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 32
+allocate: 128
+=== "report"===
+allocate: 512
+allocate: 256
+allocate: 1024
+allocate: 56
+allocate: 157
+allocate: 628
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CLOSURE [0] <fn "worker">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "worker">> ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_CLOSURE [1] <fn "pass">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0007   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0010   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ <native spawn> ]
+0013   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ]
+0016   OP_CONSTANT [2] "a"
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "a" ]
+0018   OP_CONSTANT [3] 3
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "a" ][ 3 ]
+0020   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ]
+0022   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "worker">>> ]
+0024   OP_POP
+           stackframe: [ <closure <script>> ]
+0025   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ <native spawn> ]
+0028   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ]
+0031   OP_CONSTANT [4] "b"
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "b" ]
+0033   OP_CONSTANT [5] 2
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "b" ][ 2 ]
+0035   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ]
+0037   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "worker">>> ]
+0039   OP_POP
+           stackframe: [ <closure <script>> ]
+0040   OP_CONSTANT [6] "main spawned"
+           stackframe: [ <closure <script>> ][ "main spawned" ]
+0042   OP_PRINT
+"main spawned"
+           stackframe: [ <closure <script>> ]
+0043   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0046   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0000   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "a" ][ 3 ]
+0000   OP_CONSTANT [0] 1
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ][ "a" ][ " " ]
+0025   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ][ "a " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ][ "a " ][ 1 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ][ "a 1" ]
+0029   OP_PRINT
+"a 1"
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "b" ][ 2 ]
+0000   OP_CONSTANT [0] 1
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ][ "b" ][ " " ]
+0025   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ][ "b " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ][ "b " ][ 1 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ][ "b 1" ]
+0029   OP_PRINT
+"b 1"
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0001   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ][ nil ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0048   OP_POP
+           stackframe: [ <closure <script>> ]
+0049   OP_CONSTANT [7] "main 1"
+           stackframe: [ <closure <script>> ][ "main 1" ]
+0051   OP_PRINT
+"main 1"
+           stackframe: [ <closure <script>> ]
+0052   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0055   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0000   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "a" ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ][ "a" ][ " " ]
+0025   OP_ADD_STR
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ][ "a " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ][ "a " ][ 2 ]
+0028   OP_ADD
+allocate: 56
+gc collect 224 bytes
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ][ "a 2" ]
+0029   OP_PRINT
+"a 2"
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "b" ][ 2 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ][ "b" ][ " " ]
+0025   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ][ "b " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ][ "b " ][ 2 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ][ "b 2" ]
+0029   OP_PRINT
+"b 2"
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0001   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ][ nil ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0057   OP_POP
+           stackframe: [ <closure <script>> ]
+0058   OP_CONSTANT [8] "main 2"
+           stackframe: [ <closure <script>> ][ "main 2" ]
+0060   OP_PRINT
+"main 2"
+           stackframe: [ <closure <script>> ]
+0061   OP_CLOSURE [9] <fn "inner">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "inner">> ]
+0063   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0066   OP_CLOSURE [10] <fn "outer">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "outer">> ]
+0068   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0071   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <closure <fn "outer">> ]
+0074   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "outer">>> ]
+0076   OP_DEFINE_GLOBAL [13] 
+           stackframe: [ <closure <script>> ]
+0079   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "outer">>> ]
+0082   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0000   OP_GET_GLOBAL [11] 
+           stackframe: [ nil ][ <closure <fn "inner">> ]
+0003   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ]
+0005   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ][ <coroutine <closure <fn "inner">>> ]
+0007   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0000   OP_CONSTANT [0] "inner 1"
+           stackframe: [ nil ][ "inner 1" ]
+0002   OP_PRINT
+"inner 1"
+           stackframe: [ nil ]
+0003   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ]
+0008   OP_CONSTANT [0] "outer between"
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ][ "outer between" ]
+0010   OP_PRINT
+"outer between"
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ]
+0011   OP_GET_LOCAL [1] 
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ][ <coroutine <closure <fn "inner">>> ]
+0013   OP_RESUME_COROUTINE
+           stackframe: [ nil ]
+0004   OP_CONSTANT [1] "inner 2"
+           stackframe: [ nil ][ "inner 2" ]
+0006   OP_PRINT
+"inner 2"
+           stackframe: [ nil ]
+0007   OP_NIL
+           stackframe: [ nil ][ nil ]
+0008   OP_RETURN
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ]
+0014   OP_CONSTANT [1] "outer done"
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ][ "outer done" ]
+0016   OP_PRINT
+"outer done"
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ]
+0017   OP_NIL
+           stackframe: [ nil ][ <coroutine <closure <fn "inner">>> ][ nil ]
+0018   OP_RETURN
+           stackframe: [ <closure <script>> ]
+0083   OP_CONSTANT [11] "main after outer"
+           stackframe: [ <closure <script>> ][ "main after outer" ]
+0085   OP_PRINT
+"main after outer"
+           stackframe: [ <closure <script>> ]
+0086   OP_CONSTANT [12] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0088   OP_DEFINE_GLOBAL [14] 
+           stackframe: [ <closure <script>> ]
+0091   OP_CLOSURE [13] <fn "count">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "count">> ]
+0093   OP_DEFINE_GLOBAL [15] 
+           stackframe: [ <closure <script>> ]
+0096   OP_CLOSURE [14] <fn "report">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "report">> ]
+0098   OP_DEFINE_GLOBAL [16] 
+           stackframe: [ <closure <script>> ]
+0101   OP_CONSTANT [15] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 0 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 0 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 0 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 0 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 0 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 0 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 0 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 1 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 1 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 1 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 1 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+gc collect 1048 bytes
+           stackframe: [ <closure <script>> ][ 1 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 1 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 1 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 2 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 2 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 2 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 2 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 2 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 2 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 2 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 3 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 3 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 3 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 3 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 3 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 3 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 3 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 4 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 4 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 4 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 4 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 4 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 4 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 4 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 4 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 4 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 4 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 5 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 5 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 5 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 5 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 5 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 5 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 5 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 5 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 5 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 5 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 6 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 6 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 6 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 6 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 6 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 6 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 6 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 6 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 6 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 6 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 7 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 7 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 7 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 7 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 7 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 7 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 7 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 7 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 7 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 7 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 8 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 8 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 8 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 8 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 8 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 8 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 8 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 8 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 8 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 8 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 9 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 9 ]
+0108 OP_JUMP          108  -> 122
+           stackframe: [ <closure <script>> ][ 9 ]
+0122   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ 9 ][ <native spawn> ]
+0125   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ 9 ][ <native spawn> ][ <closure <fn "count">> ]
+0128   OP_CONSTANT [18] 3
+           stackframe: [ <closure <script>> ][ 9 ][ <native spawn> ][ <closure <fn "count">> ][ 3 ]
+0130   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ 9 ][ <native spawn> ][ <coroutine <closure <fn "count">>> ]
+0132   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 9 ][ <coroutine <closure <fn "count">>> ]
+0134   OP_POP
+           stackframe: [ <closure <script>> ][ 9 ]
+0135 OP_LOOP          135  -> 111
+           stackframe: [ <closure <script>> ][ 9 ]
+0111   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 10 ]
+0103 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 10 103  -> 138
+           stackframe: [ <closure <script>> ][ 10 ]
+0138   OP_POP
+           stackframe: [ <closure <script>> ]
+0139   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ <native spawn> ]
+0142   OP_GET_GLOBAL [16] 
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "report">> ]
+0145   OP_CONSTANT [19] 3
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "report">> ][ 3 ]
+0147   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "report">>> ]
+0149   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "report">>> ]
+0151   OP_POP
+           stackframe: [ <closure <script>> ]
+0152   OP_CONSTANT [20] "main returns"
+           stackframe: [ <closure <script>> ][ "main returns" ]
+0154   OP_PRINT
+"main returns"
+           stackframe: [ <closure <script>> ]
+0155   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0156   OP_RETURN
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "a" ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ][ "a" ][ " " ]
+0025   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ][ "a " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ][ "a " ][ 3 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ][ "a 3" ]
+0029   OP_PRINT
+"a 3"
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "b" ][ 2 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "b" ][ 2 ][ 3 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "b" ][ 2 ][ 3 ]
+0034   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "b" ][ 2 ][ "b" ]
+0037   OP_CONSTANT [3] " done"
+           stackframe: [ nil ][ "b" ][ 2 ][ "b" ][ " done" ]
+0039   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "b" ][ 2 ][ "b done" ]
+0040   OP_PRINT
+"b done"
+           stackframe: [ nil ][ "b" ][ 2 ]
+0041   OP_NIL
+           stackframe: [ nil ][ "b" ][ 2 ][ nil ]
+0042   OP_RETURN
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 0 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 0 ][ 1 ]
+0026   OP_ADD
+           stackframe: [ nil ][ 3 ][ 0 ][ 1 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 1 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 1 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 1 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 2 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 2 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 2 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 2 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 3 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 3 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 3 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 3 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 4 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 4 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 4 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 4 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 5 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 5 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 5 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 5 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 6 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 6 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 6 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 6 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 7 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 7 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 7 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 7 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 8 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 8 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 8 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 8 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 9 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 9 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 9 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 0 ][ 9 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 0 ][ 10 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 0 ][ 10 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 0 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ]
+0000   OP_CONSTANT [0] 0
+           stackframe: [ nil ][ 3 ][ 0 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 25
+           stackframe: [ nil ][ 3 ][ 0 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 0 ]
+0021   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "a" ][ 3 ][ 3 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "a" ][ 3 ][ 4 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "a" ][ 3 ][ 4 ]
+0034   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "a" ][ 3 ][ "a" ]
+0037   OP_CONSTANT [3] " done"
+           stackframe: [ nil ][ "a" ][ 3 ][ "a" ][ " done" ]
+0039   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "a" ][ 3 ][ "a done" ]
+0040   OP_PRINT
+"a done"
+           stackframe: [ nil ][ "a" ][ 3 ]
+0041   OP_NIL
+           stackframe: [ nil ][ "a" ][ 3 ][ nil ]
+0042   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 4848 bytes
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 10 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 10 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 11 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 11 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 11 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 11 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 12 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 12 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 12 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 12 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 13 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 13 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 13 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 13 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 14 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 14 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 14 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 14 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 15 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 15 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 15 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 15 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 16 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 16 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 16 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 16 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 17 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 17 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 17 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 17 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 18 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 18 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 18 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 18 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 19 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 19 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 19 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 1 ][ 19 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 1 ][ 20 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 1 ][ 20 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 1 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 0 ]
+0022 OP_LOOP          22   -> 10
+           stackframe: [ nil ][ 3 ][ 0 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 1 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 25
+           stackframe: [ nil ][ 3 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 1 ]
+0021   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 20 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 20 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 21 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 21 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 21 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 21 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 22 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 22 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 22 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 22 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 23 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 23 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 23 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 23 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 24 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 24 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 24 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 24 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 25 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 25 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 25 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 25 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 26 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 26 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 26 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 26 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 27 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 27 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 27 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 27 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 28 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 28 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 28 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 28 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 29 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 29 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 29 ]
+0024   OP_CONSTANT [2] 1
+           stackframe: [ nil ][ 3 ][ 2 ][ 29 ][ 1 ]
+0026   OP_ADD_INT
+           stackframe: [ nil ][ 3 ][ 2 ][ 30 ]
+0027   OP_SET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 2 ][ 30 ]
+0030   OP_POP
+           stackframe: [ nil ][ 3 ][ 2 ]
+0031   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 1 ]
+0022 OP_LOOP          22   -> 10
+           stackframe: [ nil ][ 3 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 2 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 25
+           stackframe: [ nil ][ 3 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ 3 ][ 2 ]
+0021   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 1792 bytes
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0032 OP_LOOP          32   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 35
+           stackframe: [ nil ][ 3 ][ 3 ]
+0035   OP_POP
+           stackframe: [ nil ][ 3 ]
+0036   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0037   OP_RETURN
+           stackframe: [ nil ][ 3 ][ 2 ]
+0022 OP_LOOP          22   -> 10
+           stackframe: [ nil ][ 3 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+gc collect 7168 bytes
+           stackframe: [ nil ][ 3 ][ 3 ]
+0002 OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL [2] [1] 2    -> 25
+           stackframe: [ nil ][ 3 ][ 3 ]
+0025   OP_POP
+           stackframe: [ nil ][ 3 ]
+0026   OP_GET_GLOBAL [14] 
+           stackframe: [ nil ][ 3 ][ 30 ]
+0029   OP_PRINT
+30
+           stackframe: [ nil ][ 3 ]
+0030   OP_NIL
+           stackframe: [ nil ][ 3 ][ nil ]
+0031   OP_RETURN
@@ -0,0 +1,465 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 64
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 256
+allocate: 43
+allocate: 172
+=== "worker"===
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 3
+allocate: 12
+=== "pass"===
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 56
+allocate: 256
+allocate: 128
+allocate: 512
+allocate: 56
+allocate: 56
+allocate: 56
+allocate: 92
+allocate: 368
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CLOSURE [0] <fn "worker">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "worker">> ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_CLOSURE [1] <fn "pass">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0007   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0010   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ <native spawn> ]
+0013   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ]
+0016   OP_CONSTANT [2] "lo"
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "lo" ]
+0018   OP_CONSTANT [3] 2
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "lo" ][ 2 ]
+0020   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ]
+0022   OP_CONSTANT [4] 1
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ][ 1 ]
+0024   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "worker">>> ]
+0026   OP_POP
+           stackframe: [ <closure <script>> ]
+0027   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ <native spawn> ]
+0030   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ]
+0033   OP_CONSTANT [5] "hi"
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "hi" ]
+0035   OP_CONSTANT [6] 2
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "hi" ][ 2 ]
+0037   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ]
+0039   OP_CONSTANT [7] 7
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ][ 7 ]
+0041   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "worker">>> ]
+0043   OP_POP
+           stackframe: [ <closure <script>> ]
+0044   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ <native spawn> ]
+0047   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ]
+0050   OP_CONSTANT [8] "mid a"
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "mid a" ]
+0052   OP_CONSTANT [9] 2
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "mid a" ][ 2 ]
+0054   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ]
+0056   OP_CONSTANT [10] 4
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ][ 4 ]
+0058   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "worker">>> ]
+0060   OP_POP
+           stackframe: [ <closure <script>> ]
+0061   OP_GET_GLOBAL [6] 
+           stackframe: [ <closure <script>> ][ <native spawn> ]
+0064   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ]
+0067   OP_CONSTANT [11] "mid b"
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "mid b" ]
+0069   OP_CONSTANT [12] 2
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <closure <fn "worker">> ][ "mid b" ][ 2 ]
+0071   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ]
+0073   OP_CONSTANT [13] 4
+           stackframe: [ <closure <script>> ][ <native spawn> ][ <coroutine <closure <fn "worker">>> ][ 4 ]
+0075   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "worker">>> ]
+0077   OP_POP
+           stackframe: [ <closure <script>> ]
+0078   OP_CONSTANT [14] "main spawned"
+           stackframe: [ <closure <script>> ][ "main spawned" ]
+0080   OP_PRINT
+"main spawned"
+           stackframe: [ <closure <script>> ]
+0081   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0084   OP_CALL [0] 
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0000   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "hi" ][ 2 ]
+0000   OP_CONSTANT [0] 1
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ][ "hi" ][ " " ]
+0025   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ][ "hi " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ][ "hi " ][ 1 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ][ "hi 1" ]
+0029   OP_PRINT
+"hi 1"
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "hi" ][ 2 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ][ "hi" ][ " " ]
+0025   OP_ADD_STR
+gc collect 56 bytes
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ][ "hi " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ][ "hi " ][ 2 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ][ "hi 2" ]
+0029   OP_PRINT
+"hi 2"
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "hi" ][ 2 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "hi" ][ 2 ][ 3 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "hi" ][ 2 ][ 3 ]
+0034   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "hi" ][ 2 ][ "hi" ]
+0037   OP_CONSTANT [3] " done"
+           stackframe: [ nil ][ "hi" ][ 2 ][ "hi" ][ " done" ]
+0039   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "hi" ][ 2 ][ "hi done" ]
+0040   OP_PRINT
+"hi done"
+           stackframe: [ nil ][ "hi" ][ 2 ]
+0041   OP_NIL
+           stackframe: [ nil ][ "hi" ][ 2 ][ nil ]
+0042   OP_RETURN
+           stackframe: [ nil ][ "mid a" ][ 2 ]
+0000   OP_CONSTANT [0] 1
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ][ "mid a" ][ " " ]
+0025   OP_ADD_STR
+allocate: 56
+allocate: 512
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ][ "mid a " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ][ "mid a " ][ 1 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ][ "mid a 1" ]
+0029   OP_PRINT
+"mid a 1"
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "mid b" ][ 2 ]
+0000   OP_CONSTANT [0] 1
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ][ "mid b" ][ " " ]
+0025   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ][ "mid b " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ][ "mid b " ][ 1 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ][ "mid b 1" ]
+0029   OP_PRINT
+"mid b 1"
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ][ "mid a" ][ " " ]
+0025   OP_ADD_STR
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ][ "mid a " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ][ "mid a " ][ 2 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ][ "mid a 2" ]
+0029   OP_PRINT
+"mid a 2"
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ][ "mid b" ][ " " ]
+0025   OP_ADD_STR
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ][ "mid b " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ][ "mid b " ][ 2 ]
+0028   OP_ADD
+allocate: 56
+gc collect 1360 bytes
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ][ "mid b 2" ]
+0029   OP_PRINT
+"mid b 2"
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 3 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "mid a" ][ 2 ][ 3 ]
+0034   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "mid a" ][ 2 ][ "mid a" ]
+0037   OP_CONSTANT [3] " done"
+           stackframe: [ nil ][ "mid a" ][ 2 ][ "mid a" ][ " done" ]
+0039   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "mid a" ][ 2 ][ "mid a done" ]
+0040   OP_PRINT
+"mid a done"
+           stackframe: [ nil ][ "mid a" ][ 2 ]
+0041   OP_NIL
+           stackframe: [ nil ][ "mid a" ][ 2 ][ nil ]
+0042   OP_RETURN
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 3 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "mid b" ][ 2 ][ 3 ]
+0034   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "mid b" ][ 2 ][ "mid b" ]
+0037   OP_CONSTANT [3] " done"
+           stackframe: [ nil ][ "mid b" ][ 2 ][ "mid b" ][ " done" ]
+0039   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "mid b" ][ 2 ][ "mid b done" ]
+0040   OP_PRINT
+"mid b done"
+           stackframe: [ nil ][ "mid b" ][ 2 ]
+0041   OP_NIL
+           stackframe: [ nil ][ "mid b" ][ 2 ][ nil ]
+0042   OP_RETURN
+           stackframe: [ nil ][ "lo" ][ 2 ]
+0000   OP_CONSTANT [0] 1
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ][ "lo" ][ " " ]
+0025   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ][ "lo " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ][ "lo " ][ 1 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ][ "lo 1" ]
+0029   OP_PRINT
+"lo 1"
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "lo" ][ 2 ][ 1 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ]
+0007 OP_JUMP          7    -> 21
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ]
+0021   OP_SUPER_GET_LOCAL_CONSTANT (OP_GET_LOCAL)
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ][ "lo" ][ " " ]
+0025   OP_ADD_STR
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ][ "lo " ]
+0026   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ][ "lo " ][ 2 ]
+0028   OP_ADD
+allocate: 56
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ][ "lo 2" ]
+0029   OP_PRINT
+"lo 2"
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ]
+0030   OP_YIELD_COROUTINE
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ]
+0031 OP_LOOP          31   -> 10
+           stackframe: [ nil ][ "lo" ][ 2 ][ 2 ]
+0010   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ nil ][ "lo" ][ 2 ][ 3 ]
+0002 OP_JUMP_IF_GREATER_LOCAL_LOCAL [3] [2] 2    -> 34
+           stackframe: [ nil ][ "lo" ][ 2 ][ 3 ]
+0034   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ nil ][ "lo" ][ 2 ][ "lo" ]
+0037   OP_CONSTANT [3] " done"
+           stackframe: [ nil ][ "lo" ][ 2 ][ "lo" ][ " done" ]
+0039   OP_ADD_STR
+allocate: 56
+           stackframe: [ nil ][ "lo" ][ 2 ][ "lo done" ]
+0040   OP_PRINT
+"lo done"
+           stackframe: [ nil ][ "lo" ][ 2 ]
+0041   OP_NIL
+           stackframe: [ nil ][ "lo" ][ 2 ][ nil ]
+0042   OP_RETURN
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ]
+0001   OP_NIL
+           stackframe: [ <closure <script>> ][ <closure <fn "pass">> ][ nil ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ nil ]
+0086   OP_POP
+           stackframe: [ <closure <script>> ]
+0087   OP_CONSTANT [15] "main back"
+           stackframe: [ <closure <script>> ][ "main back" ]
+0089   OP_PRINT
+"main back"
+           stackframe: [ <closure <script>> ]
+0090   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0091   OP_RETURN
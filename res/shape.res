@@ -0,0 +1,624 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 32
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 16
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 16
+allocate: 56
+allocate: 256
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 32
+allocate: 64
+allocate: 256
+allocate: 64
+allocate: 128
+allocate: 47
+allocate: 188
+=== "init"===
+allocate: 64
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 16
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 16
+allocate: 64
+=== "sum"===
+allocate: 128
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 256
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 128
+allocate: 512
+allocate: 16
+allocate: 32
+allocate: 72
+allocate: 56
+allocate: 512
+allocate: 64
+allocate: 56
+allocate: 768
+allocate: 256
+allocate: 1024
+allocate: 56
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
+=== "f"===
+allocate: 56
+allocate: 144
+allocate: 56
+allocate: 128
+allocate: 56
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 5
+allocate: 20
+=== "g"===
+allocate: 56
+allocate: 512
+allocate: 288
+allocate: 211
+allocate: 844
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CLASS [0] "P"
+allocate: 72
+allocate: 80
+           stackframe: [ <closure <script>> ][ <class "P"> ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <class "P"> ]
+0008   OP_CLOSURE [2] <fn "init">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <class "P"> ][ <closure <fn "init">> ]
+0010   OP_METHOD [1] "init"
+allocate: 192
+           stackframe: [ <closure <script>> ][ <class "P"> ]
+0012   OP_CLOSURE [4] <fn "sum">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <class "P"> ][ <closure <fn "sum">> ]
+0014   OP_METHOD [3] "sum"
+           stackframe: [ <closure <script>> ][ <class "P"> ]
+0016   OP_POP
+           stackframe: [ <closure <script>> ]
+0017   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <class "P"> ]
+0020   OP_CONSTANT [5] 1
+           stackframe: [ <closure <script>> ][ <class "P"> ][ 1 ]
+0022   OP_CONSTANT [6] 2
+           stackframe: [ <closure <script>> ][ <class "P"> ][ 1 ][ 2 ]
+0024   OP_CALL [2] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ]
+0000 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [1] 0 0    -> 26
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ]
+0005   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ][ <instance <class "P">> ]
+0007   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ][ <instance <class "P">> ][ 1 ]
+0009   OP_SET_PROPERTY [1] "x" cache 0
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ][ 1 ]
+0013   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ][ <instance <class "P">> ]
+0016   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ][ <instance <class "P">> ][ 2 ]
+0018   OP_SET_PROPERTY [2] "y" cache 1
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ][ 2 ]
+0022   OP_POP
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ]
+0023 OP_JUMP          23   -> 44
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ]
+0044   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 2 ][ <instance <class "P">> ]
+0046   OP_RETURN
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0026   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <class "P"> ]
+0029   OP_CONSTANT [31] -1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <class "P"> ][ -1 ]
+0031   OP_CONSTANT [8] 5
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <class "P"> ][ -1 ][ 5 ]
+0033   OP_CALL [2] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ]
+0000 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [1] 0 0    -> 26
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ]
+0026   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ][ <instance <class "P">> ]
+0028   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ][ <instance <class "P">> ][ 5 ]
+0030   OP_SET_PROPERTY [3] "y" cache 2
+allocate: 80
+allocate: 16
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ][ 5 ]
+0034   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ][ <instance <class "P">> ]
+0037   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ][ <instance <class "P">> ][ -1 ]
+0039   OP_SET_PROPERTY [4] "x" cache 3
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ][ -1 ]
+0043   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ][ <instance <class "P">> ]
+0046   OP_RETURN
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0035   OP_GET_GLOBAL [9] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <class "P"> ]
+0038   OP_CONSTANT [9] 3
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <class "P"> ][ 3 ]
+0040   OP_CONSTANT [10] 4
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <class "P"> ][ 3 ][ 4 ]
+0042   OP_CALL [2] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ]
+0000 OP_JUMP_IF_NOT_GREATER_LOCAL_CONST [1] 0 0    -> 26
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ]
+0005   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ][ <instance <class "P">> ]
+0007   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ][ <instance <class "P">> ][ 3 ]
+0009   OP_SET_PROPERTY [1] "x" cache 0
+allocate: 16
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ][ 3 ]
+0013   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ][ <instance <class "P">> ]
+0016   OP_GET_LOCAL [2] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ][ <instance <class "P">> ][ 4 ]
+0018   OP_SET_PROPERTY [2] "y" cache 1
+allocate: 32
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ][ 4 ]
+0022   OP_POP
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ]
+0023 OP_JUMP          23   -> 44
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ]
+0044   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ][ <instance <class "P">> ]
+0046   OP_RETURN
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0044   OP_ARRAY size: 3
+allocate: 40
+allocate: 48
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ]
+0046   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0049   OP_CONSTANT [11] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0051   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0054   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ 0 ]
+0057   OP_CONSTANT [12] 3
+           stackframe: [ <closure <script>> ][ 0 ][ 3 ]
+0059   OP_LESS
+           stackframe: [ <closure <script>> ][ true ]
+0060 OP_JUMP_IF_FALSE 60   -> 124
+           stackframe: [ <closure <script>> ][ true ]
+0063   OP_POP
+           stackframe: [ <closure <script>> ]
+0064   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ]
+0067   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ][ 0 ]
+0070   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0071   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0073   OP_GET_PROPERTY [13] "x" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ]
+0077   OP_PRINT
+1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0078   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0080   OP_GET_PROPERTY [14] "y" cache 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 2 ]
+0084   OP_PRINT
+2
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0085   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0087   OP_INVOKE(args: 0) [15] "sum" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0000   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0002   OP_GET_PROPERTY [0] "x" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 1 ]
+0006   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 1 ][ <instance <class "P">> ]
+0008   OP_GET_PROPERTY [1] "y" cache 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 1 ][ 2 ]
+0012   OP_ADD
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ]
+0013   OP_RETURN
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 3 ]
+0092   OP_PRINT
+3
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0093   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0095   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 0 ]
+0098   OP_SET_PROPERTY [16] "z" cache 2
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 64
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 0 ]
+0102   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0105   OP_GET_PROPERTY [17] "z" cache 3
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 0 ]
+0109   OP_PRINT
+0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0110   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 0 ]
+0113   OP_CONSTANT [18] 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 0 ][ 1 ]
+0115   OP_ADD
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ]
+0116   OP_SET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ]
+0119   OP_POPN size: 2
+           stackframe: [ <closure <script>> ]
+0121 OP_LOOP          121  -> 54
+           stackframe: [ <closure <script>> ]
+0054   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ 1 ]
+0057   OP_CONSTANT [12] 3
+           stackframe: [ <closure <script>> ][ 1 ][ 3 ]
+0059   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ true ]
+0060 OP_JUMP_IF_FALSE 60   -> 124
+           stackframe: [ <closure <script>> ][ true ]
+0063   OP_POP
+           stackframe: [ <closure <script>> ]
+0064   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ]
+0067   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ][ 1 ]
+0070   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0071   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0073   OP_GET_PROPERTY [13] "x" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ -1 ]
+0077   OP_PRINT
+-1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0078   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0080   OP_GET_PROPERTY [14] "y" cache 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 5 ]
+0084   OP_PRINT
+5
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0085   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0087   OP_INVOKE(args: 0) [15] "sum" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0000   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0002   OP_GET_PROPERTY [0] "x" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ]
+0006   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ <instance <class "P">> ]
+0008   OP_GET_PROPERTY [1] "y" cache 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ -1 ][ 5 ]
+0012   OP_ADD_INT
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 4 ]
+0013   OP_RETURN
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 4 ]
+0092   OP_PRINT
+4
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0093   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0095   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 1 ]
+0098   OP_SET_PROPERTY [16] "z" cache 2
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 64
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ]
+0102   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0105   OP_GET_PROPERTY [17] "z" cache 3
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ]
+0109   OP_PRINT
+1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0110   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ]
+0113   OP_CONSTANT [18] 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 1 ][ 1 ]
+0115   OP_ADD_INT
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 2 ]
+0116   OP_SET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 2 ]
+0119   OP_POPN size: 2
+           stackframe: [ <closure <script>> ]
+0121 OP_LOOP          121  -> 54
+           stackframe: [ <closure <script>> ]
+0054   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ 2 ]
+0057   OP_CONSTANT [12] 3
+           stackframe: [ <closure <script>> ][ 2 ][ 3 ]
+0059   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ true ]
+0060 OP_JUMP_IF_FALSE 60   -> 124
+           stackframe: [ <closure <script>> ][ true ]
+0063   OP_POP
+           stackframe: [ <closure <script>> ]
+0064   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ]
+0067   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ][ 2 ]
+0070   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0071   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0073   OP_GET_PROPERTY [13] "x" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 3 ]
+0077   OP_PRINT
+3
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0078   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0080   OP_GET_PROPERTY [14] "y" cache 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 4 ]
+0084   OP_PRINT
+4
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0085   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0087   OP_INVOKE(args: 0) [15] "sum" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0000   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0002   OP_GET_PROPERTY [0] "x" cache 0
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ]
+0006   OP_GET_LOCAL [0] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ <instance <class "P">> ]
+0008   OP_GET_PROPERTY [1] "y" cache 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 3 ][ 4 ]
+0012   OP_ADD_INT
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 7 ]
+0013   OP_RETURN
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 7 ]
+0092   OP_PRINT
+7
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0093   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0095   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ][ 2 ]
+0098   OP_SET_PROPERTY [16] "z" cache 2
+allocate: 64
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 2 ]
+0102   OP_SUPER_POP_GET_LOCAL (OP_POP)
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ <instance <class "P">> ]
+0105   OP_GET_PROPERTY [17] "z" cache 3
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 2 ]
+0109   OP_PRINT
+2
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0110   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 2 ]
+0113   OP_CONSTANT [18] 1
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 2 ][ 1 ]
+0115   OP_ADD_INT
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 3 ]
+0116   OP_SET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ][ 3 ]
+0119   OP_POPN size: 2
+           stackframe: [ <closure <script>> ]
+0121 OP_LOOP          121  -> 54
+           stackframe: [ <closure <script>> ]
+0054   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ 3 ]
+0057   OP_CONSTANT [12] 3
+           stackframe: [ <closure <script>> ][ 3 ][ 3 ]
+0059   OP_LESS_INT
+           stackframe: [ <closure <script>> ][ false ]
+0060 OP_JUMP_IF_FALSE 60   -> 124
+           stackframe: [ <closure <script>> ][ false ]
+0124   OP_POP
+           stackframe: [ <closure <script>> ]
+0125   OP_CLASS [19] "Q"
+allocate: 72
+allocate: 80
+           stackframe: [ <closure <script>> ][ <class "Q"> ]
+0127   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0130   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <class "Q"> ]
+0133   OP_CLOSURE [21] <fn "f">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <class "Q"> ][ <closure <fn "f">> ]
+0135   OP_METHOD [20] "f"
+allocate: 192
+           stackframe: [ <closure <script>> ][ <class "Q"> ]
+0137   OP_POP
+           stackframe: [ <closure <script>> ]
+0138   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ <class "Q"> ]
+0141   OP_CALL [0] 
+allocate: 56
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ]
+0143   OP_DEFINE_GLOBAL [13] 
+           stackframe: [ <closure <script>> ]
+0146   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ]
+0149   OP_INVOKE(args: 0) [22] "f" cache 1
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ]
+0000   OP_CONSTANT [0] "method"
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ][ "method" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ "method" ]
+0154   OP_PRINT
+"method"
+           stackframe: [ <closure <script>> ]
+0155   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ]
+0158   OP_CONSTANT [24] "field"
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ][ "field" ]
+0160   OP_SET_PROPERTY [23] "f" cache 4
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ "field" ]
+0164   OP_POP
+           stackframe: [ <closure <script>> ]
+0165   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ]
+0168   OP_GET_PROPERTY [25] "f" cache 5
+           stackframe: [ <closure <script>> ][ "field" ]
+0172   OP_PRINT
+"field"
+           stackframe: [ <closure <script>> ]
+0173   OP_CLOSURE [26] <fn "g">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "g">> ]
+0175   OP_DEFINE_GLOBAL [14] 
+           stackframe: [ <closure <script>> ]
+0178   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ]
+0181   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ][ <closure <fn "g">> ]
+0184   OP_SET_PROPERTY [27] "h" cache 6
+allocate: 80
+allocate: 8
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <closure <fn "g">> ]
+0188   OP_POP
+           stackframe: [ <closure <script>> ]
+0189   OP_GET_GLOBAL [13] 
+           stackframe: [ <closure <script>> ][ <instance <class "Q">> ]
+0192   OP_INVOKE(args: 0) [28] "h" cache 2
+           stackframe: [ <closure <script>> ][ <closure <fn "g">> ]
+0000   OP_CONSTANT [0] "fn"
+           stackframe: [ <closure <script>> ][ <closure <fn "g">> ][ "fn" ]
+0002   OP_RETURN
+           stackframe: [ <closure <script>> ][ "fn" ]
+0197   OP_PRINT
+"fn"
+           stackframe: [ <closure <script>> ]
+0198   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ]
+0201   OP_CONSTANT [29] 1
+           stackframe: [ <closure <script>> ][ [<instance <class "P">>, <instance <class "P">>, <instance <class "P">>] ][ 1 ]
+0203   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ <instance <class "P">> ]
+0204   OP_GET_PROPERTY [30] "z" cache 7
+           stackframe: [ <closure <script>> ][ 1 ]
+0208   OP_PRINT
+1
+           stackframe: [ <closure <script>> ]
+0209   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0210   OP_RETURN
@@ -1,60 +1,89 @@
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 80
-allocate: 40
-allocate: 96
-allocate: 56
-allocate: 136
-allocate: 80
-allocate: 40
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 56
+allocate: 32
+allocate: 4
 allocate: 16
-allocate: 80
-allocate: 40
+allocate: 8
 allocate: 32
-allocate: 80
-allocate: 40
+allocate: 16
 allocate: 64
-allocate: 136
-allocate: 80
-allocate: 40
+allocate: 56
+allocate: 256
+allocate: 152
+allocate: 56
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
 allocate: 16
+allocate: 8
+allocate: 32
+allocate: 6
+allocate: 24
 === "showVariable"===
+allocate: 64
+allocate: 56
+allocate: 32
+allocate: 128
+allocate: 56
+allocate: 56
 allocate: 128
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
+allocate: 64
 allocate: 256
-allocate: 80
-allocate: 40
-allocate: 80
-allocate: 40
-allocate: 136
-allocate: 80
-allocate: 40
+allocate: 56
+allocate: 56
+allocate: 768
+allocate: 152
+allocate: 56
 allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 7
+allocate: 28
 === "showGreeting"===
+allocate: 61
+allocate: 244
 === <script> ===
-allocate: 80
-allocate: 160
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
            stackframe: [ <closure <script>> ]
 0000   OP_CONSTANT [0] "outer"
            stackframe: [ <closure <script>> ][ "outer" ]
@@ -65,69 +94,63 @@ allocate: 160
 0006   OP_PRINT
 "inside"
            stackframe: [ <closure <script>> ][ "outer" ][ "inside" ]
-0007   OP_POP
-           stackframe: [ <closure <script>> ][ "outer" ]
-0008   OP_POP
+0007   OP_POPN size: 2
            stackframe: [ <closure <script>> ]
-0009   OP_CLOSURE [3] <fn "showVariable">
-allocate: 80
+0009   OP_CLOSURE [2] <fn "showVariable">
+allocate: 48
            stackframe: [ <closure <script>> ][ <closure <fn "showVariable">> ]
-0011   OP_DEFINE_GLOBAL [2] "showVariable"
-allocate: 56
+0011   OP_DEFINE_GLOBAL [9] 
            stackframe: [ <closure <script>> ]
-0013   OP_CONSTANT [5] "after"
+0014   OP_CONSTANT [3] "after"
            stackframe: [ <closure <script>> ][ "after" ]
-0015   OP_DEFINE_GLOBAL [4] "global"
-allocate: 56
+0016   OP_DEFINE_GLOBAL [10] 
            stackframe: [ <closure <script>> ]
-0017   OP_GET_GLOBAL [6] "showVariable"
+0019   OP_GET_GLOBAL [9] 
            stackframe: [ <closure <script>> ][ <closure <fn "showVariable">> ]
-0019   OP_CALL [0] 
+0022   OP_CALL [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "showVariable">> ]
-0000   OP_GET_GLOBAL [0] "global"
+0000   OP_GET_GLOBAL [10] 
            stackframe: [ <closure <script>> ][ <closure <fn "showVariable">> ][ "after" ]
-0002   OP_PRINT
+0003   OP_PRINT
 "after"
            stackframe: [ <closure <script>> ][ <closure <fn "showVariable">> ]
-0003   OP_NIL
+0004   OP_NIL
            stackframe: [ <closure <script>> ][ <closure <fn "showVariable">> ][ nil ]
-0004   OP_RETURN
+0005   OP_RETURN
            stackframe: [ <closure <script>> ][ nil ]
-0021   OP_POP
+0024   OP_POP
            stackframe: [ <closure <script>> ]
-0022   OP_CONSTANT [8] "Global Hello"
+0025   OP_CONSTANT [4] "Global Hello"
            stackframe: [ <closure <script>> ][ "Global Hello" ]
-0024   OP_DEFINE_GLOBAL [7] "greeting"
-allocate: 56
+0027   OP_DEFINE_GLOBAL [11] 
            stackframe: [ <closure <script>> ]
-0026   OP_GET_GLOBAL [9] "greeting"
+0030   OP_GET_GLOBAL [11] 
            stackframe: [ <closure <script>> ][ "Global Hello" ]
-0028   OP_PRINT
+0033   OP_PRINT
 "Global Hello"
            stackframe: [ <closure <script>> ]
-0029   OP_CONSTANT [10] "Local Hello"
+0034   OP_CONSTANT [5] "Local Hello"
            stackframe: [ <closure <script>> ][ "Local Hello" ]
-0031   OP_GET_LOCAL [1] 
+0036   OP_GET_LOCAL [1] 
            stackframe: [ <closure <script>> ][ "Local Hello" ][ "Local Hello" ]
-0033   OP_PRINT
+0038   OP_PRINT
 "Local Hello"
            stackframe: [ <closure <script>> ][ "Local Hello" ]
-0034   OP_POP
+0039   OP_POP
            stackframe: [ <closure <script>> ]
-0035   OP_GET_GLOBAL [11] "greeting"
+0040   OP_GET_GLOBAL [11] 
            stackframe: [ <closure <script>> ][ "Global Hello" ]
-0037   OP_PRINT
+0043   OP_PRINT
 "Global Hello"
            stackframe: [ <closure <script>> ]
-0038   OP_CLOSURE [13] <fn "showGreeting">
-allocate: 80
+0044   OP_CLOSURE [6] <fn "showGreeting">
+allocate: 48
            stackframe: [ <closure <script>> ][ <closure <fn "showGreeting">> ]
-0040   OP_DEFINE_GLOBAL [12] "showGreeting"
-allocate: 56
+0046   OP_DEFINE_GLOBAL [12] 
            stackframe: [ <closure <script>> ]
-0042   OP_GET_GLOBAL [14] "showGreeting"
+0049   OP_GET_GLOBAL [12] 
            stackframe: [ <closure <script>> ][ <closure <fn "showGreeting">> ]
-0044   OP_CALL [0] 
+0052   OP_CALL [0] 
            stackframe: [ <closure <script>> ][ <closure <fn "showGreeting">> ]
 0000   OP_CONSTANT [0] "Function Hello"
            stackframe: [ <closure <script>> ][ <closure <fn "showGreeting">> ][ "Function Hello" ]
@@ -140,13 +163,13 @@ allocate: 56
            stackframe: [ <closure <script>> ][ <closure <fn "showGreeting">> ][ "Function Hello" ][ nil ]
 0006   OP_RETURN
            stackframe: [ <closure <script>> ][ nil ]
-0046   OP_POP
+0054   OP_POP
            stackframe: [ <closure <script>> ]
-0047   OP_GET_GLOBAL [15] "greeting"
+0055   OP_GET_GLOBAL [11] 
            stackframe: [ <closure <script>> ][ "Global Hello" ]
-0049   OP_PRINT
+0058   OP_PRINT
 "Global Hello"
            stackframe: [ <closure <script>> ]
-0050   OP_NIL
+0059   OP_NIL
            stackframe: [ <closure <script>> ][ nil ]
-0051   OP_RETURN
+0060   OP_RETURN
@@ -0,0 +1,639 @@
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 192
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 128
+allocate: 64
+allocate: 56
+allocate: 384
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 56
+allocate: 64
+allocate: 152
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 16
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 64
+allocate: 256
+allocate: 32
+allocate: 128
+=== "fib"===
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 56
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 56
+allocate: 256
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 28
+allocate: 112
+=== "task"===
+allocate: 64
+allocate: 56
+allocate: 768
+allocate: 32
+allocate: 128
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 56
+allocate: 128
+allocate: 512
+allocate: 256
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 16
+allocate: 32
+allocate: 128
+allocate: 32
+allocate: 64
+allocate: 64
+allocate: 256
+allocate: 45
+allocate: 180
+=== "part"===
+allocate: 56
+allocate: 152
+allocate: 16
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 32
+allocate: 64
+allocate: 32
+allocate: 128
+allocate: 64
+allocate: 256
+allocate: 128
+allocate: 128
+allocate: 512
+allocate: 256
+allocate: 56
+allocate: 106
+allocate: 424
+=== "sum"===
+allocate: 56
+allocate: 256
+allocate: 1024
+allocate: 512
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 16
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 7
+allocate: 28
+=== "broken"===
+allocate: 56
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 64
+allocate: 9
+allocate: 36
+=== "scaled"===
+allocate: 56
+allocate: 152
+allocate: 1
+allocate: 4
+allocate: 2
+allocate: 8
+allocate: 4
+allocate: 16
+allocate: 8
+allocate: 32
+allocate: 16
+allocate: 16
+allocate: 64
+allocate: 13
+allocate: 52
+=== "via"===
+allocate: 56
+allocate: 237
+allocate: 948
+=== <script> ===
+allocate: 48
+allocate: 176
+allocate: 512
+allocate: 192
+           stackframe: [ <closure <script>> ]
+0000   OP_CLOSURE [0] <fn "fib">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "fib">> ]
+0002   OP_DEFINE_GLOBAL [9] 
+           stackframe: [ <closure <script>> ]
+0005   OP_CONSTANT [1] 100
+           stackframe: [ <closure <script>> ][ 100 ]
+0007   OP_DEFINE_GLOBAL [10] 
+           stackframe: [ <closure <script>> ]
+0010   OP_CLOSURE [2] <fn "task">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "task">> ]
+0012   OP_DEFINE_GLOBAL [11] 
+           stackframe: [ <closure <script>> ]
+0015   OP_ARRAY size: 0
+allocate: 40
+           stackframe: [ <closure <script>> ][ [] ]
+0017   OP_DEFINE_GLOBAL [12] 
+           stackframe: [ <closure <script>> ]
+0020   OP_CONSTANT [3] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0022 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 22   -> 73
+           stackframe: [ <closure <script>> ][ 0 ]
+0027 OP_JUMP          27   -> 41
+           stackframe: [ <closure <script>> ][ 0 ]
+0041   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ]
+0044   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ]
+0047   OP_GET_GLOBAL [7] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <native submit> ]
+0050   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <native submit> ][ <closure <fn "task">> ]
+0053   OP_CONSTANT [6] 8
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <native submit> ][ <closure <fn "task">> ][ 8 ]
+0055   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <native submit> ][ <closure <fn "task">> ][ 8 ]
+0058   OP_CONSTANT [7] "t"
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <native submit> ][ <closure <fn "task">> ][ 8 ][ "t" ]
+0060   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <native submit> ][ <closure <fn "task">> ][ 8 ][ "t" ][ 0 ]
+0062   OP_ADD
+allocate: 56
+allocate: 512
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <native submit> ][ <closure <fn "task">> ][ 8 ][ "t0" ]
+0063   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <native submit> ][ <coroutine <closure <fn "task">>> ]
+0065   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native push> ][ [] ][ <coroutine <closure <fn "task">>> ]
+0067   OP_CALL [2] 
+allocate: 16
+           stackframe: [ <closure <script>> ][ 0 ][ nil ]
+0069   OP_POP
+           stackframe: [ <closure <script>> ][ 0 ]
+0070 OP_LOOP          70   -> 30
+           stackframe: [ <closure <script>> ][ 0 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ]
+0022 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 22   -> 73
+           stackframe: [ <closure <script>> ][ 1 ]
+0027 OP_JUMP          27   -> 41
+           stackframe: [ <closure <script>> ][ 1 ]
+0041   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ]
+0044   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ]
+0047   OP_GET_GLOBAL [7] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <native submit> ]
+0050   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ]
+0053   OP_CONSTANT [6] 8
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 8 ]
+0055   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 9 ]
+0058   OP_CONSTANT [7] "t"
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 9 ][ "t" ]
+0060   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 9 ][ "t" ][ 1 ]
+0062   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 9 ][ "t1" ]
+0063   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <native submit> ][ <coroutine <closure <fn "task">>> ]
+0065   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native push> ][ [<coroutine <closure <fn "task">>>] ][ <coroutine <closure <fn "task">>> ]
+0067   OP_CALL [2] 
+allocate: 32
+           stackframe: [ <closure <script>> ][ 1 ][ nil ]
+0069   OP_POP
+           stackframe: [ <closure <script>> ][ 1 ]
+0070 OP_LOOP          70   -> 30
+           stackframe: [ <closure <script>> ][ 1 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ]
+0022 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 22   -> 73
+           stackframe: [ <closure <script>> ][ 2 ]
+0027 OP_JUMP          27   -> 41
+           stackframe: [ <closure <script>> ][ 2 ]
+0041   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ]
+0044   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ]
+0047   OP_GET_GLOBAL [7] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ]
+0050   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ]
+0053   OP_CONSTANT [6] 8
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 8 ]
+0055   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 10 ]
+0058   OP_CONSTANT [7] "t"
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 10 ][ "t" ]
+0060   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 10 ][ "t" ][ 2 ]
+0062   OP_ADD
+allocate: 56
+gc collect 112 bytes
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 10 ][ "t2" ]
+0063   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <coroutine <closure <fn "task">>> ]
+0065   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <coroutine <closure <fn "task">>> ]
+0067   OP_CALL [2] 
+allocate: 64
+           stackframe: [ <closure <script>> ][ 2 ][ nil ]
+0069   OP_POP
+           stackframe: [ <closure <script>> ][ 2 ]
+0070 OP_LOOP          70   -> 30
+           stackframe: [ <closure <script>> ][ 2 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ]
+0022 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 22   -> 73
+           stackframe: [ <closure <script>> ][ 3 ]
+0027 OP_JUMP          27   -> 41
+           stackframe: [ <closure <script>> ][ 3 ]
+0041   OP_GET_GLOBAL [3] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ]
+0044   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ]
+0047   OP_GET_GLOBAL [7] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ]
+0050   OP_GET_GLOBAL [11] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ]
+0053   OP_CONSTANT [6] 8
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 8 ]
+0055   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 11 ]
+0058   OP_CONSTANT [7] "t"
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 11 ][ "t" ]
+0060   OP_SUPER_GET_LOCAL_ADD (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 11 ][ "t" ][ 3 ]
+0062   OP_ADD
+allocate: 56
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <closure <fn "task">> ][ 11 ][ "t3" ]
+0063   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <native submit> ][ <coroutine <closure <fn "task">>> ]
+0065   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native push> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ <coroutine <closure <fn "task">>> ]
+0067   OP_CALL [2] 
+           stackframe: [ <closure <script>> ][ 3 ][ nil ]
+0069   OP_POP
+           stackframe: [ <closure <script>> ][ 3 ]
+0070 OP_LOOP          70   -> 30
+           stackframe: [ <closure <script>> ][ 3 ]
+0030   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 4 ]
+0022 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 22   -> 73
+           stackframe: [ <closure <script>> ][ 4 ]
+0073   OP_POP
+           stackframe: [ <closure <script>> ]
+0074   OP_CONSTANT [8] 0
+           stackframe: [ <closure <script>> ][ 0 ]
+0076 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 76   -> 110
+           stackframe: [ <closure <script>> ][ 0 ]
+0081 OP_JUMP          81   -> 95
+           stackframe: [ <closure <script>> ][ 0 ]
+0095   OP_GET_GLOBAL [8] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native join> ]
+0098   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native join> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ]
+0101   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 0 ][ <native join> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ 0 ]
+0103   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 0 ][ <native join> ][ <coroutine <closure <fn "task">>> ]
+0104   OP_CALL [1] 
+allocate: 40
+allocate: 56
+allocate: 16
+allocate: 32
+           stackframe: [ <closure <script>> ][ 0 ][ ["t0", 122] ]
+0106   OP_PRINT
+["t0", 122]
+           stackframe: [ <closure <script>> ][ 0 ]
+0107 OP_LOOP          107  -> 84
+           stackframe: [ <closure <script>> ][ 0 ]
+0084   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 1 ]
+0076 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 76   -> 110
+           stackframe: [ <closure <script>> ][ 1 ]
+0081 OP_JUMP          81   -> 95
+           stackframe: [ <closure <script>> ][ 1 ]
+0095   OP_GET_GLOBAL [8] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native join> ]
+0098   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native join> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ]
+0101   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 1 ][ <native join> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ 1 ]
+0103   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 1 ][ <native join> ][ <coroutine <closure <fn "task">>> ]
+0104   OP_CALL [1] 
+allocate: 40
+allocate: 56
+allocate: 16
+allocate: 32
+           stackframe: [ <closure <script>> ][ 1 ][ ["t1", 135] ]
+0106   OP_PRINT
+["t1", 135]
+           stackframe: [ <closure <script>> ][ 1 ]
+0107 OP_LOOP          107  -> 84
+gc collect 368 bytes
+           stackframe: [ <closure <script>> ][ 1 ]
+0084   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 2 ]
+0076 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 76   -> 110
+           stackframe: [ <closure <script>> ][ 2 ]
+0081 OP_JUMP          81   -> 95
+           stackframe: [ <closure <script>> ][ 2 ]
+0095   OP_GET_GLOBAL [8] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native join> ]
+0098   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native join> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ]
+0101   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 2 ][ <native join> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ 2 ]
+0103   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 2 ][ <native join> ][ <coroutine <closure <fn "task">>> ]
+0104   OP_CALL [1] 
+allocate: 40
+allocate: 56
+allocate: 16
+allocate: 32
+           stackframe: [ <closure <script>> ][ 2 ][ ["t2", 156] ]
+0106   OP_PRINT
+["t2", 156]
+           stackframe: [ <closure <script>> ][ 2 ]
+0107 OP_LOOP          107  -> 84
+           stackframe: [ <closure <script>> ][ 2 ]
+0084   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 3 ]
+0076 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 76   -> 110
+           stackframe: [ <closure <script>> ][ 3 ]
+0081 OP_JUMP          81   -> 95
+           stackframe: [ <closure <script>> ][ 3 ]
+0095   OP_GET_GLOBAL [8] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native join> ]
+0098   OP_GET_GLOBAL [12] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native join> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ]
+0101   OP_GET_LOCAL [1] 
+           stackframe: [ <closure <script>> ][ 3 ][ <native join> ][ [<coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>, <coroutine <closure <fn "task">>>] ][ 3 ]
+0103   OP_GET_ELEMENT_ARRAY
+           stackframe: [ <closure <script>> ][ 3 ][ <native join> ][ <coroutine <closure <fn "task">>> ]
+0104   OP_CALL [1] 
+allocate: 40
+allocate: 56
+allocate: 16
+allocate: 32
+           stackframe: [ <closure <script>> ][ 3 ][ ["t3", 190] ]
+0106   OP_PRINT
+["t3", 190]
+           stackframe: [ <closure <script>> ][ 3 ]
+0107 OP_LOOP          107  -> 84
+           stackframe: [ <closure <script>> ][ 3 ]
+0084   OP_SUPER_GET_LOCAL_CONSTANT_ADD_SET_LOCAL_POP_LOOP (OP_GET_LOCAL)
+           stackframe: [ <closure <script>> ][ 4 ]
+0076 OP_JUMP_IF_NOT_LESS_LOCAL_CONST [1] 4 76   -> 110
+           stackframe: [ <closure <script>> ][ 4 ]
+0110   OP_POP
+           stackframe: [ <closure <script>> ]
+0111   OP_GET_GLOBAL [10] 
+           stackframe: [ <closure <script>> ][ 100 ]
+0114   OP_PRINT
+100
+           stackframe: [ <closure <script>> ]
+0115   OP_CLOSURE [11] <fn "part">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "part">> ]
+0117   OP_DEFINE_GLOBAL [13] 
+           stackframe: [ <closure <script>> ]
+0120   OP_CLOSURE [12] <fn "sum">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "sum">> ]
+0122   OP_DEFINE_GLOBAL [14] 
+           stackframe: [ <closure <script>> ]
+0125   OP_GET_GLOBAL [7] 
+           stackframe: [ <closure <script>> ][ <native submit> ]
+0128   OP_GET_GLOBAL [14] 
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ]
+0131   OP_CONSTANT [13] 1
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ][ 1 ]
+0133   OP_CONSTANT [14] 2
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ][ 1 ][ 2 ]
+0135   OP_CONSTANT [15] 3
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ][ 1 ][ 2 ][ 3 ]
+0137   OP_CONSTANT [16] 4
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ][ 1 ][ 2 ][ 3 ][ 4 ]
+0139   OP_CONSTANT [17] 5
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ][ 1 ][ 2 ][ 3 ][ 4 ][ 5 ]
+0141   OP_CONSTANT [18] 6
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ][ 1 ][ 2 ][ 3 ][ 4 ][ 5 ][ 6 ]
+0143   OP_ARRAY size: 6
+allocate: 40
+allocate: 96
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ][ [1, 2, 3, 4, 5, 6] ]
+0145   OP_CONSTANT [19] 6
+           stackframe: [ <closure <script>> ][ <native submit> ][ <closure <fn "sum">> ][ [1, 2, 3, 4, 5, 6] ][ 6 ]
+0147   OP_CREATE_COROUTINE size: 2
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 32
+           stackframe: [ <closure <script>> ][ <native submit> ][ <coroutine <closure <fn "sum">>> ]
+0149   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <coroutine <closure <fn "sum">>> ]
+0151   OP_DEFINE_GLOBAL [15] 
+           stackframe: [ <closure <script>> ]
+0154   OP_GET_GLOBAL [8] 
+           stackframe: [ <closure <script>> ][ <native join> ]
+0157   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ <native join> ][ <coroutine <closure <fn "sum">>> ]
+0160   OP_CALL [1] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+           stackframe: [ <closure <script>> ][ {"count" : 6, "sum" : 21} ]
+0162   OP_CONSTANT [20] "sum"
+           stackframe: [ <closure <script>> ][ {"count" : 6, "sum" : 21} ][ "sum" ]
+0164   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 21 ]
+0165   OP_PRINT
+21
+           stackframe: [ <closure <script>> ]
+0166   OP_GET_GLOBAL [8] 
+           stackframe: [ <closure <script>> ][ <native join> ]
+0169   OP_GET_GLOBAL [15] 
+           stackframe: [ <closure <script>> ][ <native join> ][ <coroutine <closure <fn "sum">>> ]
+0172   OP_CALL [1] 
+allocate: 72
+allocate: 48
+allocate: 104
+allocate: 48
+           stackframe: [ <closure <script>> ][ {"count" : 6, "sum" : 21} ]
+0174   OP_CONSTANT [21] "count"
+           stackframe: [ <closure <script>> ][ {"count" : 6, "sum" : 21} ][ "count" ]
+0176   OP_GET_ELEMENT
+           stackframe: [ <closure <script>> ][ 6 ]
+0177   OP_PRINT
+6
+           stackframe: [ <closure <script>> ]
+0178   OP_CLOSURE [22] <fn "broken">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "broken">> ]
+0180   OP_DEFINE_GLOBAL [16] 
+           stackframe: [ <closure <script>> ]
+0183   OP_GET_GLOBAL [8] 
+           stackframe: [ <closure <script>> ][ <native join> ]
+0186   OP_GET_GLOBAL [7] 
+           stackframe: [ <closure <script>> ][ <native join> ][ <native submit> ]
+0189   OP_GET_GLOBAL [16] 
+           stackframe: [ <closure <script>> ][ <native join> ][ <native submit> ][ <closure <fn "broken">> ]
+0192   OP_CREATE_COROUTINE size: 0
+allocate: 176
+allocate: 512
+allocate: 192
+gc collect 936 bytes
+           stackframe: [ <closure <script>> ][ <native join> ][ <native submit> ][ <coroutine <closure <fn "broken">>> ]
+0194   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <native join> ][ <coroutine <closure <fn "broken">>> ]
+0196   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ nil ]
+0198   OP_PRINT
+nil
+           stackframe: [ <closure <script>> ]
+0199   OP_CONSTANT [23] 3
+           stackframe: [ <closure <script>> ][ 3 ]
+0201   OP_DEFINE_GLOBAL [17] 
+           stackframe: [ <closure <script>> ]
+0204   OP_CLOSURE [24] <fn "scaled">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "scaled">> ]
+0206   OP_DEFINE_GLOBAL [18] 
+           stackframe: [ <closure <script>> ]
+0209   OP_CLOSURE [25] <fn "via">
+allocate: 48
+           stackframe: [ <closure <script>> ][ <closure <fn "via">> ]
+0211   OP_DEFINE_GLOBAL [19] 
+           stackframe: [ <closure <script>> ]
+0214   OP_GET_GLOBAL [8] 
+           stackframe: [ <closure <script>> ][ <native join> ]
+0217   OP_GET_GLOBAL [7] 
+           stackframe: [ <closure <script>> ][ <native join> ][ <native submit> ]
+0220   OP_GET_GLOBAL [19] 
+           stackframe: [ <closure <script>> ][ <native join> ][ <native submit> ][ <closure <fn "via">> ]
+0223   OP_CONSTANT [26] 5
+           stackframe: [ <closure <script>> ][ <native join> ][ <native submit> ][ <closure <fn "via">> ][ 5 ]
+0225   OP_CREATE_COROUTINE size: 1
+allocate: 176
+allocate: 512
+allocate: 192
+allocate: 16
+           stackframe: [ <closure <script>> ][ <native join> ][ <native submit> ][ <coroutine <closure <fn "via">>> ]
+0227   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ <native join> ][ <coroutine <closure <fn "via">>> ]
+0229   OP_CALL [1] 
+           stackframe: [ <closure <script>> ][ 16 ]
+0231   OP_PRINT
+16
+           stackframe: [ <closure <script>> ]
+0232   OP_CONSTANT [27] "done"
+           stackframe: [ <closure <script>> ][ "done" ]
+0234   OP_PRINT
+"done"
+           stackframe: [ <closure <script>> ]
+0235   OP_NIL
+           stackframe: [ <closure <script>> ][ nil ]
+0236   OP_RETURN
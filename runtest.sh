@@ -30,9 +30,12 @@ else
         base_name=$(basename "$test_file" .lox)
         result_file="${res_dir}/${base_name}.res"
         
+        # 首行 "// flags: ..." 给出运行该测试时的命令行选项
+        flags=$(sed -n '1s|^// flags: ||p' "$test_file")
+
         echo "正在运行测试文件: $test_file"
         # 执行测试并将输出（标准输出和标准错误）重定向到结果文件
-        if build/lox "$test_file" > "$result_file"; then
+        if build/lox $flags "$test_file" > "$result_file"; then
             echo "测试通过: $test_file"
         else
             echo "测试失败: $test_file"
@@ -5,6 +5,7 @@
 #include "obj.hpp"
 #include "memory.hpp"
 #include "vm.hpp"
+#include "optimizer.hpp"
 #include <string_view>
 
 Complication::Complication(VM &vm) : current_(nullptr), parser_(nullptr), vm_(vm), get_rule_({
@@ -79,6 +80,10 @@ auto Complication::end_compiler() -> std::pair<ObjFunction *, std::unique_ptr<Co
 {
     emit_return();
     ObjFunction *function = current_->function_;
+#ifdef OPTIMIZE_BYTECODE
+    if (!parser_->has_error_)
+        optimize_chunk(function->chunk_);
+#endif
 #ifdef DEBUG_MODE
     if (!parser_->has_error_)
     {
@@ -350,6 +355,7 @@ void Complication::super_(bool assign)
         name_variable(syntehtic_token("super"), false);
         emit_bytes(OP_SUPER_INVOKE, name);
         emit_byte(argCount);
+        emit_invoke_cache();
     }
     else
     {
@@ -455,16 +461,19 @@ void Complication::dot(bool canAssign)
     {
         expression();
         emit_bytes(OP_SET_PROPERTY, arg);
+        emit_cache();
     }
     else if (match(TOKEN_LEFT_PAREN))
     {
         uint8_t argCount = argument_list();
         emit_bytes(OP_INVOKE, arg);
         emit_byte(argCount);
+        emit_invoke_cache();
     }
     else
     {
         emit_bytes(OP_GET_PROPERTY, arg);
+        emit_cache();
     }
 }
 
@@ -476,17 +485,20 @@ void Complication::while_statement()
 
     int loopStart = current_chunk()->bytecode_.size();
     consume(TOKEN_LEFT_PAREN, "Expect '(' after 'while'.");
-    expression();
+    auto tree = register_expression();
+    if (tree == nullptr)
+        expression();
     consume(TOKEN_RIGHT_PAREN, "Expect ')' after condition.");
 
-    int exitJump = emit_jump(OP_JUMP_IF_FALSE);
-    emit_byte(OP_POP);
+    bool fused;
+    int exitJump = tree != nullptr ? emit_register_condition(*tree, loopStart, fused) : emit_condition_jump(loopStart, fused);
     statement();
     emit_loop(loopStart);
-    patch_offset(loopStart, current_chunk()->bytecode_.size());
 
     patch_jump(exitJump);
-    emit_byte(OP_POP);
+    if (!fused)
+        emit_byte(OP_POP);
+    patch_offset(loopStart, current_chunk()->bytecode_.size());
     current_loop_ = std::move(current_loop_->outer_);
 }
 
@@ -514,22 +526,29 @@ void Complication::for_statement()
 
     int loopStart = current_chunk()->bytecode_.size();
     int exitJump = -1;
+    bool fused = false;
     if (!match(TOKEN_SEMICOLON))
     {
-        expression();
+        auto tree = register_expression();
+        if (tree == nullptr)
+            expression();
         consume(TOKEN_SEMICOLON, "Expect ';' after loop condition.");
 
         // Jump out of the loop if the condition is false.
-        exitJump = emit_jump(OP_JUMP_IF_FALSE);
-        emit_byte(OP_POP); // Condition.
+        exitJump = tree != nullptr ? emit_register_condition(*tree, loopStart, fused) : emit_condition_jump(loopStart, fused);
     }
 
     if (!match(TOKEN_RIGHT_PAREN))
     {
         int bodyJump = emit_jump(OP_JUMP);
         int incrementStart = current_chunk()->bytecode_.size();
-        expression();
-        emit_byte(OP_POP);
+        if (auto tree = register_expression())
+            emit_register_effect(*tree);
+        else
+        {
+            expression();
+            emit_byte(OP_POP);
+        }
         consume(TOKEN_RIGHT_PAREN, "Expect ')' after for clauses.");
 
         emit_loop(loopStart);
@@ -539,13 +558,14 @@ void Complication::for_statement()
 
     statement();
     emit_loop(loopStart);
-    patch_offset(loopStart, current_chunk()->bytecode_.size());
 
     if (exitJump != -1)
     {
         patch_jump(exitJump);
-        emit_byte(OP_POP); // Condition.
+        if (!fused)
+            emit_byte(OP_POP); // Condition.
     }
+    patch_offset(loopStart, current_chunk()->bytecode_.size()); // break lands past the condition's pop
 
     current_loop_ = std::move(current_loop_->outer_);
     end_scope();
@@ -592,7 +612,10 @@ void Complication::return_statement()
         if (current_->type_ == TYPE_INITIALIZER)
             parser_->error("Can't return a value from an initializer.");
 
-        expression();
+        if (auto tree = register_expression())
+            emit_register_value(*tree, current_->local_count_);
+        else
+            expression();
         consume(TOKEN_SEMICOLON, "Expect ';' after return value.");
         emit_byte(OP_RETURN);
     }
@@ -600,7 +623,10 @@ void Complication::return_statement()
 
 void Complication::print_statement()
 {
-    expression();
+    if (auto tree = register_expression())
+        emit_register_value(*tree, current_->local_count_);
+    else
+        expression();
     consume(TOKEN_SEMICOLON, "At the end of statement required ;.");
     emit_byte(OP_PRINT);
 }
@@ -608,15 +634,19 @@ void Complication::print_statement()
 void Complication::if_statement()
 {
     consume(TOKEN_LEFT_PAREN, "Expect '(' after 'if'.");
-    expression();
+    int conditionStart = current_chunk()->bytecode_.size();
+    auto tree = register_expression();
+    if (tree == nullptr)
+        expression();
     consume(TOKEN_RIGHT_PAREN, "Expect ')' after condition.");
 
-    int thenJump = emit_jump(OP_JUMP_IF_FALSE);
-    emit_byte(OP_POP);
+    bool fused;
+    int thenJump = tree != nullptr ? emit_register_condition(*tree, conditionStart, fused) : emit_condition_jump(conditionStart, fused);
     statement();
     int elseJump = emit_jump(OP_JUMP);
     patch_jump(thenJump);
-    emit_byte(OP_POP);
+    if (!fused)
+        emit_byte(OP_POP);
 
     if (match(TOKEN_ELSE))
         statement();
@@ -625,6 +655,12 @@ void Complication::if_statement()
 
 void Complication::expression_statement()
 {
+    if (auto tree = register_expression())
+    {
+        consume(TOKEN_SEMICOLON, "expression_statement needs ;.");
+        emit_register_effect(*tree);
+        return;
+    }
     expression();
     consume(TOKEN_SEMICOLON, "expression_statement needs ;.");
     emit_byte(OP_POP);
@@ -632,9 +668,15 @@ void Complication::expression_statement()
 
 void Complication::var_declaration()
 {
-    uint8_t global = parse_variable("Expect variable declare.");
+    uint16_t global = parse_variable("Expect variable declare.");
     if (match(TOKEN_EQUAL))
-        expression();
+    {
+        auto tree = register_expression();
+        if (tree == nullptr)
+            expression();
+        else // a local's slot is already taken, and its value goes there
+            emit_register_value(*tree, current_->scope_depth_ > 0 ? current_->local_count_ - 1 : current_->local_count_);
+    }
     else
         emit_byte(OP_NIL);
     consume(TOKEN_SEMICOLON, "Variable declaration needs ;.");
@@ -657,20 +699,18 @@ void Complication::name_variable(const Token &name, bool canAssign)
     }
     else
     {
-        arg = identifier_constant(name);
+        arg = global_slot(name);
         getOp = OP_GET_GLOBAL;
         setOp = OP_SET_GLOBAL;
     }
 
-    if (canAssign && match(TOKEN_EQUAL))
-    {
+    bool isSet = canAssign && match(TOKEN_EQUAL);
+    if (isSet)
         expression();
-        emit_bytes(setOp, arg);
-    }
+    if (getOp == OP_GET_GLOBAL)
+        emit_short(isSet ? setOp : getOp, arg); // global slots take a 16-bit operand
     else
-    {
-        emit_bytes(getOp, arg);
-    }
+        emit_bytes(isSet ? setOp : getOp, arg);
 }
 
 int Complication::resolve_local(const std::unique_ptr<Compiler> &compiler, const Token &name)
@@ -764,13 +804,24 @@ int Complication::add_upvalue(const std::unique_ptr<Compiler> &compiler, int ind
     return compiler->function_->upvalue_count_++;
 }
 
-uint8_t Complication::parse_variable(const std::string_view &message)
+uint16_t Complication::parse_variable(const std::string_view &message)
 {
     consume(TOKEN_IDENTIFIER, message);
     declare_local();                // this function define local
     if (current_->scope_depth_ > 0) // below is global
         return 0;                   // global's value need to be writen into chunk
-    return identifier_constant(parser_->previous_);
+    return global_slot(parser_->previous_);
+}
+
+uint16_t Complication::global_slot(const Token &token)
+{
+    if (vm_.global_values_.size() > UINT16_MAX)
+    {
+        parser_->error("Too many global variables.");
+        return 0;
+    }
+    std::string_view str = token.string;
+    return vm_.global_slot(create_obj_string(str, vm_));
 }
 
 uint8_t Complication::identifier_constant(const Token &token)
@@ -787,6 +838,48 @@ int Complication::emit_jump(Opcode instruction)
     return current_chunk()->bytecode_.size() - 2;
 }
 
+int Complication::emit_condition_jump(int conditionStart, bool &fused)
+{
+    // a condition compiled to exactly `local|constant, local|constant, OP_EQUAL|OP_LESS|OP_GREATER[, OP_NOT]`,
+    // with a local first or second, is re-emitted as one compare-and-jump that pushes nothing
+    auto chunk = current_chunk();
+    auto at = [&](int i) { return chunk->bytecode_[conditionStart + i]; };
+    int length = chunk->bytecode_.size() - conditionStart;
+    bool negated = length == 6 && at(5) == OP_NOT;
+    bool shaped = length == 5 || negated;
+    bool localFirst = shaped && at(0) == OP_GET_LOCAL && (at(2) == OP_GET_LOCAL || at(2) == OP_CONSTANT);
+    bool constantFirst = shaped && at(0) == OP_CONSTANT && at(2) == OP_GET_LOCAL;
+    fused = (localFirst || constantFirst) && (at(4) == OP_EQUAL || at(4) == OP_LESS || at(4) == OP_GREATER);
+    if (!fused)
+    {
+        int jump = emit_jump(OP_JUMP_IF_FALSE);
+        emit_byte(OP_POP);
+        return jump;
+    }
+
+    auto compare = static_cast<Opcode>(at(4));
+    uint8_t slot = at(1), operand = at(3);
+    if (constantFirst) // k < a is a > k
+    {
+        std::swap(slot, operand);
+        compare = compare == OP_LESS ? OP_GREATER : compare == OP_GREATER ? OP_LESS : compare;
+    }
+    bool constant = at(2) != OP_GET_LOCAL || constantFirst;
+    chunk->bytecode_.resize(conditionStart);
+    chunk->lines_.resize(conditionStart);
+    return emit_compare_jump(compare, negated, slot, operand, constant);
+}
+
+// local `compare` a local or constant, jumping when the result is false (true when negated)
+int Complication::emit_compare_jump(Opcode compare, bool negated, uint8_t slot, uint8_t operand, bool constant)
+{
+    int index = (compare == OP_EQUAL ? 0 : compare == OP_LESS ? 1 : 2) + (negated ? 3 : 0) + (constant ? 6 : 0);
+    emit_bytes(FIRST_COMPARE_JUMP + index, slot);
+    emit_byte(operand);
+    emit_bytes(0xff, 0xff);
+    return current_chunk()->bytecode_.size() - 2;
+}
+
 void Complication::patch_jump(int offset)
 {
     int jump = current_chunk()->bytecode_.size() - offset - 2;
@@ -852,7 +945,7 @@ void Complication::class_declaration()
 
     declare_local();                    // register if it is local varibale
     emit_bytes(OP_CLASS, nameConstant); // when execute this will push objclass
-    define_global(nameConstant);        // register if it is global
+    define_global(current_->scope_depth_ > 0 ? 0 : global_slot(className)); // register if it is global
 
     auto classCompiler = std::make_unique<ClassCompiler>();
     classCompiler->enclosing_ = std::move(current_class_);
@@ -896,7 +989,7 @@ void Complication::class_declaration()
 
 void Complication::fun_declaration()
 {
-    uint8_t global = parse_variable("Expect function name."); // before closure all function is global
+    uint16_t global = parse_variable("Expect function name."); // before closure all function is global
     mark_initialize();                                        // why initialize
     function(TYPE_FUNCTION);
     define_global(global);
@@ -980,18 +1073,18 @@ bool Complication::identifier_equal(const Token &a, const Token &b)
     return a.string == b.string;
 }
 
-void Complication::define_global(uint8_t global) // only define global
+void Complication::define_global(uint16_t global) // only define global
 {
     if (current_->scope_depth_ > 0)
     {
         mark_initialize(); // begin all current local variable depth is -1
         return;            // local variable has been defined before
     }
-    auto str = current_chunk()->constants_[global].as_obj<ObjString>();
+    auto str = vm_.global_names_[global];
     if (global_table_.find(str) != global_table_.end()) // don't expect redefintion
         parser_->error("Global variable has been defined before");
     global_table_.insert(str);
-    emit_bytes(OP_DEFINE_GLOBAL, global);
+    emit_short(OP_DEFINE_GLOBAL, global);
 }
 
 Token Complication::syntehtic_token(const std::string_view text)
@@ -1037,6 +1130,33 @@ void Complication::emit_bytes(uint8_t byte1, uint8_t byte2)
     emit_byte(byte1);
     emit_byte(byte2);
 }
+void Complication::emit_short(Opcode op, uint16_t operand)
+{
+    emit_byte(op);
+    emit_bytes((operand >> 8) & 0xff, operand & 0xff);
+}
+void Complication::emit_cache()
+{
+    auto &caches = current_chunk()->caches_;
+    if (caches.size() > UINT16_MAX)
+    {
+        parser_->error("Too many property accesses in one chunk.");
+        return;
+    }
+    emit_bytes((caches.size() >> 8) & 0xff, caches.size() & 0xff);
+    caches.emplace_back();
+}
+void Complication::emit_invoke_cache()
+{
+    auto &caches = current_chunk()->invoke_caches_;
+    if (caches.size() > UINT16_MAX)
+    {
+        parser_->error("Too many method calls in one chunk.");
+        return;
+    }
+    emit_bytes((caches.size() >> 8) & 0xff, caches.size() & 0xff);
+    caches.emplace_back();
+}
 void Complication::emit_return()
 {
     if (current_->type_ == TYPE_INITIALIZER)
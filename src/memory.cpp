@@ -4,26 +4,335 @@
 #include "objstring.hpp"
 #include "common.hpp"
 #include "vm.hpp"
+#include <cstdlib>
+#include <mutex>
 
 constexpr auto GC_HEAP_GROW_FACTOR = 2;
+constexpr size_t GC_CLOCK_CHECK_INTERVAL = 64; // objects (or array values) traced or swept between deadline checks
+constexpr size_t GC_ARRAY_CHUNK = 64;		   // values of a large array traced at a time while marking incrementally
+constexpr size_t GC_PUBLISH_THRESHOLD = 64;	   // gray objects a marking thread keeps to itself before sharing half
+#ifdef STRESS_TEST
+constexpr auto STRESS_MAJOR_INTERVAL = 16; // stress runs a minor collection per allocation, and a full one every so often
+#endif
+
+// gray objects of one marking thread: the owner works on local without locking and hands half of it over to
+// shared whenever shared runs dry, where idle threads steal from
+struct MarkWorker
+{
+	std::vector<Obj *> local;
+	std::mutex mutex;
+	std::vector<Obj *> shared; // guarded by mutex
+	std::atomic<size_t> shared_size = 0;
+
+	void publish()
+	{
+		std::lock_guard lock(mutex);
+		auto half = local.size() / 2;
+		shared.insert(shared.end(), local.end() - half, local.end());
+		local.resize(local.size() - half);
+		shared_size.store(shared.size(), std::memory_order_relaxed);
+	}
+	// moves half of from.shared into local, or all of it when from is this worker
+	bool take(MarkWorker &from)
+	{
+		if (from.shared_size.load(std::memory_order_relaxed) == 0)
+			return false;
+		std::lock_guard lock(from.mutex);
+		auto n = &from == this ? from.shared.size() : (from.shared.size() + 1) / 2;
+		if (n == 0)
+			return false;
+		local.insert(local.end(), from.shared.end() - n, from.shared.end());
+		from.shared.resize(from.shared.size() - n);
+		from.shared_size.store(from.shared.size(), std::memory_order_relaxed);
+		return true;
+	}
+};
+
+static thread_local MarkWorker *marker = nullptr; // set while this thread takes part in parallel_mark
+
+GC::GC(VM &vm) noexcept
+	: vm_(vm)
+{
+	AllocBase::gc = this; // before anything allocates; a worker thread's VM takes over its own thread only
+	if (auto pause = std::getenv("LOX_GC_PAUSE_US"))
+		pause_us_ = std::max(0L, std::strtol(pause, nullptr, 10));
+	if (auto threads = std::getenv("LOX_GC_THREADS"))
+		gc_threads_ = static_cast<int>(std::max(0L, std::strtol(threads, nullptr, 10)));
+	if (auto fast_exit = std::getenv("LOX_FAST_EXIT"))
+		fast_exit_ = std::strtol(fast_exit, nullptr, 10) != 0;
+}
+
+GC::~GC()
+{
+	if (sweeper_.joinable())
+		sweeper_.join();
+	if (fast_exit_)
+		return;
+	for (auto list : {objects_, sweeping_})
+		while (list != nullptr)
+		{
+			auto next = list->next_;
+			free_object(list);
+			list = next;
+		}
+}
 
 void GC::collect()
 {
-	if(vm_.current_coroutine_ == nullptr)
-		return ;
+	if (phase_ == GCPhase::Background)
+	{
+		finish_background_sweep();
+#ifndef STRESS_TEST
+		if (!should_collect()) // only here to collect the sweeper, and the heap is back under its target
+			return;
+#endif
+	}
+	if (phase_ != GCPhase::Idle)
+	{
+		step();
+		return;
+	}
 	auto before = bytes_allocated_;
-	mark_roots();
-	trace_references();
+#ifdef GENERATIONAL_GC
+	minor_ = bytes_allocated_ <= next_gc_; // promoted objects have not outgrown the heap target yet
+#ifdef STRESS_TEST
+	static thread_local int collections = 0;
+	if (++collections % STRESS_MAJOR_INTERVAL == 0)
+		minor_ = false;
+#endif
+#endif
+	if (!minor_ && pause_us_ > 0)
+	{
+		cycle_start_bytes_ = before;
+		phase_ = GCPhase::Mark;
+		mark_roots();
+		step();
+		return;
+	}
+
+	bool parallel = !minor_ && gc_threads_ > 0;
+	if (parallel)
+		parallel_mark();
+	else
+	{
+		mark_roots();
+		if (minor_)
+			for (auto obj : remembered_)
+				blacken_object(obj);
+		trace_references();
+	}
+
+	for (auto obj : remembered_) // every survivor is promoted below, so no old-to-young reference is left
+		obj->is_remembered_ = false;
+	remembered_.clear();
+
 	remove_white_string();
+	if (parallel)
+	{
+		cycle_start_bytes_ = before;
+		start_background_sweep();
+		return;
+	}
 	sweep();
+#ifdef SLAB_ALLOC
+	if (!minor_)
+		slab::release_empty_pages();
+#endif
 #ifdef STRESS_TEST
-	if (before - bytes_allocated_ != 0)
+	if (trace_ && before - bytes_allocated_ != 0)
 		std::cout << "gc collect " << before - bytes_allocated_ << " bytes" << std::endl;
 #endif
 
+	nursery_bytes_ = 0;
+	if (!minor_)
+		next_gc_ = bytes_allocated_ * GC_HEAP_GROW_FACTOR;
+}
+
+void GC::step()
+{
+	auto deadline = Clock::now() + std::chrono::microseconds(pause_us_);
+	nursery_bytes_ = 0;
+	if (phase_ == GCPhase::Mark)
+	{
+		if (!trace_references(deadline))
+			return;
+		finish_mark();
+	}
+	if (sweep_slice(deadline))
+		finish_sweep();
+}
+
+void GC::finish_mark()
+{
+	// stacks, globals and the open upvalue list change without barriers, so scan them again and drain the rest;
+	// a coroutine marked earlier in the cycle may have run since, so its stack is rescanned even though marked
+	mark_roots();
+	for (auto co = vm_.scheduler_.current_coroutine_; co != nullptr; co = co->resumer_)
+		blacken_object(co);
+	vm_.scheduler_.for_each_ready([this](ObjCoroutine *co) { blacken_object(co); });
+	trace_references();
+
+	for (auto obj : remembered_)
+		obj->is_remembered_ = false;
+	remembered_.clear();
+
+	phase_ = GCPhase::Sweep; // dead strings leave the intern table as sweep_slice frees them
+	sweeping_ = objects_;
+	objects_ = nullptr;
+	sweep_prev_ = nullptr;
+}
+
+bool GC::sweep_slice(Clock::time_point deadline)
+{
+	Obj *object = sweep_prev_ == nullptr ? sweeping_ : sweep_prev_->next_;
+	for (size_t n = 1; object != nullptr; n++)
+	{
+		if (n % GC_CLOCK_CHECK_INTERVAL == 0 && Clock::now() >= deadline)
+			return false;
+		if (object->is_marked_)
+		{
+			object->is_marked_ = false;
+			object->is_old_ = true;
+			sweep_prev_ = object;
+			object = object->next_;
+		}
+		else
+		{
+			if (object->type_ == ObjType::String)
+				strings_.remove(static_cast<ObjString *>(object));
+			auto unreached = object;
+			object = object->next_;
+			(sweep_prev_ == nullptr ? sweeping_ : sweep_prev_->next_) = object;
+			free_object(unreached);
+		}
+	}
+	return true;
+}
+
+void GC::finish_sweep()
+{
+	// survivors go behind everything allocated during the sweep, which is still young
+	first_old_ = sweeping_;
+	if (objects_ == nullptr)
+		objects_ = sweeping_;
+	else
+		objects_tail_->next_ = sweeping_;
+	sweeping_ = sweep_prev_ = objects_tail_ = nullptr;
+	phase_ = GCPhase::Idle;
+#ifdef SLAB_ALLOC
+	slab::release_empty_pages(); // takes back what the background sweeper freed as well
+#endif
+#ifdef STRESS_TEST
+	if (trace_ && cycle_start_bytes_ > bytes_allocated_)
+		std::cout << "gc collect " << cycle_start_bytes_ - bytes_allocated_ << " bytes" << std::endl;
+#endif
 	next_gc_ = bytes_allocated_ * GC_HEAP_GROW_FACTOR;
 }
 
+void GC::parallel_mark()
+{
+	std::vector<MarkWorker> workers(gc_threads_);
+	std::atomic<int> active = gc_threads_; // threads that may still produce gray objects
+
+	auto work = [&](int self) {
+		auto &worker = workers[self];
+		marker = &worker;
+		for (;;)
+		{
+			while (!worker.local.empty())
+			{
+				auto obj = worker.local.back();
+				worker.local.pop_back();
+				blacken_object(obj);
+				if (worker.local.size() > GC_PUBLISH_THRESHOLD && worker.shared_size.load(std::memory_order_relaxed) == 0)
+					worker.publish();
+			}
+			if (steal(workers.data(), self))
+				continue;
+
+			// out of work: done once every thread is, since only a busy thread shares anything
+			active--;
+			bool resumed = false;
+			while (!resumed && active.load() != 0)
+			{
+				auto shared = std::any_of(workers.begin(), workers.end(), [](auto &w) { return w.shared_size.load() != 0; });
+				if (shared)
+				{
+					active++;
+					resumed = steal(workers.data(), self);
+					if (!resumed)
+						active--;
+				}
+				if (!resumed)
+					std::this_thread::yield();
+			}
+			if (!resumed)
+				break;
+		}
+		marker = nullptr;
+	};
+
+	marker = &workers[0]; // the mutator is worker 0 and starts out with every root
+	mark_roots();
+	std::vector<std::thread> helpers;
+	for (int i = 1; i < gc_threads_; i++)
+		helpers.emplace_back(work, i);
+	work(0);
+	for (auto &helper : helpers)
+		helper.join();
+}
+
+bool GC::steal(MarkWorker *workers, int self)
+{
+	for (int i = 0; i < gc_threads_; i++) // own shared objects first, then the next threads round
+		if (workers[self].take(workers[(self + i) % gc_threads_]))
+			return true;
+	return false;
+}
+
+void GC::start_background_sweep()
+{
+	// dead strings already left the intern table, and marking promoted the survivors,
+	// so the sweeper only touches the marks and links of objects the mutator can no longer reach or allocate
+	phase_ = GCPhase::Background;
+	sweeping_ = objects_;
+	objects_ = nullptr;
+	nursery_bytes_ = 0;
+	next_gc_ = bytes_allocated_ * GC_HEAP_GROW_FACTOR; // until the sweeper reports what it freed
+	sweeper_ = std::thread([this] {
+		AllocBase::gc = this;
+		AllocBase::sweeper = true;
+		Obj *previous = nullptr;
+		Obj *object = sweeping_;
+		while (object != nullptr)
+		{
+			if (object->is_marked_)
+			{
+				object->is_marked_ = false;
+				previous = object;
+				object = object->next_;
+			}
+			else
+			{
+				auto unreached = object;
+				object = object->next_;
+				(previous == nullptr ? sweeping_ : previous->next_) = object;
+				free_object(unreached);
+			}
+		}
+		sweep_done_.store(true, std::memory_order_release);
+	});
+}
+
+void GC::finish_background_sweep()
+{
+	sweeper_.join();
+	sweep_done_ = false;
+	bytes_allocated_ -= swept_bytes_;
+	swept_bytes_ = 0;
+	finish_sweep();
+}
+
 void GC::mark_roots()
 {
 	for (auto slot = 0; slot < vm_.current_coroutine_->top_; ++slot)
@@ -32,15 +341,20 @@ void GC::mark_roots()
 	for (int i = 0; i < vm_.current_coroutine_->frame_count_; i++)
 		mark_object(vm_.current_coroutine_->frames_.at(i).closure_);
 
-	for (auto upvalue = vm_.open_upvalues_; upvalue != nullptr; upvalue = upvalue->next_)
+	for (auto upvalue = vm_.current_coroutine_->open_upvalues_; upvalue != nullptr; upvalue = upvalue->next_)
 		mark_object(upvalue);
 
-	mark_object(vm_.scheduler_.current_coroutine_);
-	for (auto co : vm_.scheduler_.coroutines_)
-		if (co->status_ != CoroutineStatus::FINISHED)
-			mark_object(co);
+	// the running coroutine and the ones suspended in `resume` under it are reached through no other
+	// root, and like the ready ones their stacks change without barriers
+	for (auto co = vm_.scheduler_.current_coroutine_; co != nullptr; co = co->resumer_)
+		mark_coroutine(co);
+	vm_.scheduler_.for_each_ready([this](ObjCoroutine *co) { mark_coroutine(co); });
 
 	mark_table(vm_.globals_);
+	for (auto &value : vm_.global_values_)
+		if (!value.is_undefined())
+			mark_value(value);
+	mark_value(vm_.result_);
 	// mark_compiler_roots();
 	mark_object(vm_.init_string_);
 }
@@ -65,13 +379,32 @@ void GC::mark_object(Obj *const ptr)
 {
 	if (ptr == nullptr)
 		return;
+	if (marker != nullptr) // parallel_mark: whichever thread sets the mark traces the object
+	{
+		if (__atomic_exchange_n(&ptr->is_marked_, true, __ATOMIC_RELAXED))
+			return;
+		ptr->is_old_ = true; // promoted now, as the background sweeper must not write what the mutator reads
+		marker->local.push_back(ptr);
+		return;
+	}
 	if (ptr->is_marked_)
 		return;
+	if (minor_ && ptr->is_old_)
+		return;
 
 	ptr->is_marked_ = true;
 	gray_stack_.push_back(ptr);
 }
 
+void GC::mark_coroutine(Obj *const ptr)
+{
+	// stacks are written without barriers, so a minor collection rescans old live coroutines too
+	if (minor_ && ptr != nullptr && ptr->is_old_)
+		blacken_object(ptr);
+	else
+		mark_object(ptr);
+}
+
 void GC::mark_value(const Value &value)
 {
 	if (value.is_obj())
@@ -87,14 +420,40 @@ void GC::mark_table(const Table &table)
 	}
 }
 
-void GC::trace_references()
+void GC::mark_shape(const Shape &shape)
 {
-	while (!gray_stack_.empty())
+	mark_table(shape.slots_);
+	for (auto &next : shape.transitions_)
+		mark_shape(*next);
+}
+
+bool GC::trace_references(Clock::time_point deadline)
+{
+	for (size_t work = 0; scanning_ != nullptr || !gray_stack_.empty();)
 	{
+		if (work >= GC_CLOCK_CHECK_INTERVAL)
+		{
+			if (Clock::now() >= deadline)
+				return false;
+			work = 0;
+		}
+		if (scanning_ != nullptr)
+		{
+			auto &values = scanning_->values_;
+			auto end = std::min(values.size(), scan_pos_ + GC_ARRAY_CHUNK);
+			work += end - scan_pos_;
+			for (; scan_pos_ < end; scan_pos_++)
+				mark_value(values[scan_pos_]);
+			if (scan_pos_ >= values.size())
+				scanning_ = nullptr;
+			continue;
+		}
 		auto obj = gray_stack_.front();
-		blacken_object(obj);
 		gray_stack_.pop_front();
+		blacken_object(obj);
+		work++;
 	}
+	return true;
 }
 
 void GC::blacken_object(Obj *ptr)
@@ -113,6 +472,7 @@ void GC::blacken_object(Obj *ptr)
 		auto objClass = static_cast<ObjClass *>(ptr);
 		mark_object(objClass->name_);
 		mark_table(objClass->methods_);
+		mark_shape(*objClass->root_shape_);
 		break;
 	}
 	case ObjType::Closure:
@@ -134,7 +494,7 @@ void GC::blacken_object(Obj *ptr)
 	{
 		auto instance = static_cast<ObjInstance *>(ptr);
 		mark_object(instance->objClass_);
-		mark_table(instance->fields_);
+		mark_array(instance->fields_);
 		break;
 	}
 	case ObjType::Upvalue:
@@ -145,7 +505,13 @@ void GC::blacken_object(Obj *ptr)
 	case ObjType::Array:
 	{
 		auto arrayPtr = static_cast<ObjArray *>(ptr);
-		mark_array(arrayPtr->values_);
+		if (phase_ == GCPhase::Mark && arrayPtr->values_.size() > GC_ARRAY_CHUNK)
+		{
+			scanning_ = arrayPtr; // bounded by the pause budget, one chunk at a time
+			scan_pos_ = 0;
+		}
+		else
+			mark_array(arrayPtr->values_);
 		break;
 	}
 	case ObjType::Json:
@@ -164,12 +530,15 @@ void GC::blacken_object(Obj *ptr)
 		if (coPtr->status_ != CoroutineStatus::FINISHED)
 		{
 			mark_object(coPtr->closure_);
+			mark_object(coPtr->resumer_);
 			for (int i = 0; i < coPtr->top_; i++)
 				mark_value(coPtr->stack_.at(i));
 			for (auto &arg : coPtr->arguments_)
 				mark_value(arg);
 			for (int i = 0; i < coPtr->frame_count_; i++)
 				mark_object(coPtr->frames_.at(i).closure_);
+			for (auto upvalue = coPtr->open_upvalues_; upvalue != nullptr; upvalue = upvalue->next_)
+				mark_object(upvalue);
 		}
 		break;
 	}
@@ -183,50 +552,53 @@ void GC::blacken_object(Obj *ptr)
 
 void GC::remove_white_string() noexcept
 {
-	for (auto it = strings_.begin(); it != strings_.end();)
-	{
-		if (*it != nullptr && !(*it)->is_marked_)
-			it = strings_.erase(it);
-		else
-			++it;
-	}
+	if (!minor_) // a minor collection unlinks its dead strings one by one in sweep
+		strings_.remove_white();
 }
 
 void GC::sweep()
 {
 	Obj *previous = nullptr;
-	Obj *object = objects_.get();
-	while (object != nullptr)
+	Obj *object = objects_;
+	Obj *end = minor_ ? first_old_ : nullptr; // a minor collection only sweeps the young prefix
+	while (object != end)
 	{
 		if (object->is_marked_)
 		{
 			object->is_marked_ = false;
+			object->is_old_ = true;
 			previous = object;
-			object = object->next_.get();
+			object = object->next_;
 		}
 		else
 		{
-			decltype(object->next_) temp = std::move(object->next_);
-			if (previous == nullptr)
-			{
-				objects_ = std::move(temp);
-				object = objects_.get();
-			}
-			else
-			{
-				previous->next_ = std::move(temp);
-				object = previous->next_.get();
-			}
+			if (minor_ && object->type_ == ObjType::String)
+				strings_.remove(static_cast<ObjString *>(object));
+			auto unreached = object;
+			object = object->next_;
+			(previous == nullptr ? objects_ : previous->next_) = object;
+			free_object(unreached);
 		}
 	}
+	first_old_ = objects_;
+}
+
+ObjString *GC::find_string(const std::string_view &str, uint32_t hash) const
+{
+	return strings_.find(str, hash);
 }
 
-ObjString *GC::find_string(const std::string_view &str) const
+std::array<ObjStats, OBJ_TYPE_COUNT> GC::census()
 {
-	if (auto res = std::find_if(strings_.cbegin(), strings_.cend(),
-								[&str](const auto &it)
-								{ return it->content_ == str; });
-		res != strings_.end())
-		return *res;
-	return nullptr;
+	if (phase_ == GCPhase::Background) // sweeping_ belongs to the sweeper until then
+		finish_background_sweep();
+	std::array<ObjStats, OBJ_TYPE_COUNT> stats;
+	for (auto list : {objects_, sweeping_})
+		for (auto object = list; object != nullptr; object = object->next_)
+		{
+			auto &entry = stats[static_cast<size_t>(object->type_)];
+			entry.count++;
+			entry.bytes += object_footprint(object);
+		}
+	return stats;
 }
\ No newline at end of file
@@ -3,11 +3,116 @@
 #include "value.hpp"
 #include "memory.hpp"
 #include "objstring.hpp"
+#include <algorithm>
+#include <sstream>
+#include <tuple>
 
-void register_obj(std::unique_ptr<Obj, ObjDeleter> &&obj, GC &gc)
+void register_obj(Obj *obj, GC &gc)
 {
-	obj->next_ = std::move(gc.objects_);
-	gc.objects_ = std::move(obj);
+	gc.on_register(obj);
+	obj->next_ = gc.objects_;
+	gc.objects_ = obj;
+}
+
+template <typename T>
+static void free_as(Obj *obj)
+{
+	Allocator<T> alloc;
+	delete_obj(alloc, static_cast<T *>(obj));
+}
+
+void free_object(Obj *obj)
+{
+	switch (obj->type_)
+	{
+	case ObjType::BoundMethod:
+		free_as<ObjBoundMethod>(obj);
+		break;
+	case ObjType::Class:
+		free_as<ObjClass>(obj);
+		break;
+	case ObjType::Closure:
+		free_as<ObjClosure>(obj);
+		break;
+	case ObjType::Function:
+		free_as<ObjFunction>(obj);
+		break;
+	case ObjType::Instance:
+		free_as<ObjInstance>(obj);
+		break;
+	case ObjType::Native:
+		free_as<ObjNative>(obj);
+		break;
+	case ObjType::String:
+		free_as<ObjString>(obj);
+		break;
+	case ObjType::Upvalue:
+		free_as<ObjUpvalue>(obj);
+		break;
+	case ObjType::Array:
+		free_as<ObjArray>(obj);
+		break;
+	case ObjType::Json:
+		free_as<ObjJson>(obj);
+		break;
+	case ObjType::Coroutine:
+		free_as<ObjCoroutine>(obj);
+		break;
+	}
+}
+
+template <typename T, typename A>
+static size_t buffer_size(const std::vector<T, A> &vector)
+{
+	return vector.capacity() * sizeof(T);
+}
+
+size_t object_footprint(const Obj *obj)
+{
+	switch (obj->type_)
+	{
+	case ObjType::BoundMethod:
+		return sizeof(ObjBoundMethod);
+	case ObjType::Class:
+	{
+		auto klass = static_cast<const ObjClass *>(obj);
+		return sizeof(ObjClass) + klass->methods_.capacity() * sizeof(Table::Entry) + klass->root_shape_->footprint();
+	}
+	case ObjType::Closure:
+		return sizeof(ObjClosure) + buffer_size(static_cast<const ObjClosure *>(obj)->upvalues_);
+	case ObjType::Function:
+	{
+		auto &chunk = static_cast<const ObjFunction *>(obj)->chunk_;
+		return sizeof(ObjFunction) + buffer_size(chunk.bytecode_) + buffer_size(chunk.constants_) + buffer_size(chunk.lines_) +
+			   buffer_size(chunk.caches_) + buffer_size(chunk.invoke_caches_);
+	}
+	case ObjType::Instance:
+		return sizeof(ObjInstance) + buffer_size(static_cast<const ObjInstance *>(obj)->fields_);
+	case ObjType::Native:
+		return sizeof(ObjNative);
+	case ObjType::String:
+	{
+		static const auto inline_capacity = clox_string().capacity(); // short strings stay inside the object
+		auto capacity = static_cast<const ObjString *>(obj)->content_.capacity();
+		return sizeof(ObjString) + (capacity > inline_capacity ? capacity + 1 : 0);
+	}
+	case ObjType::Upvalue:
+		return sizeof(ObjUpvalue);
+	case ObjType::Array:
+		return sizeof(ObjArray) + buffer_size(static_cast<const ObjArray *>(obj)->values_);
+	case ObjType::Json:
+	{
+		auto &kv = static_cast<const ObjJson *>(obj)->kv_;
+		// libstdc++ nodes: next pointer, key/value pair and cached hash
+		return sizeof(ObjJson) + kv.bucket_count() * sizeof(void *) + kv.size() * (sizeof(void *) + sizeof(std::pair<const Value, Value>) + sizeof(size_t));
+	}
+	case ObjType::Coroutine:
+	{
+		auto co = static_cast<const ObjCoroutine *>(obj);
+		return sizeof(ObjCoroutine) + buffer_size(co->stack_) + buffer_size(co->frames_) + buffer_size(co->arguments_);
+	}
+	}
+	return 0;
 }
 
 std::ostream &operator<<(std::ostream &os, const ObjFunction &f)
@@ -63,17 +168,30 @@ std::ostream &operator<<(std::ostream &os, const ObjArray &arr)
 	return os;
 }
 
+// kv_ iterates in hash order and objects hash by address, which changes from run to run, so keys
+// print sorted: nil, booleans, numbers by value, then strings and other objects by their text
 std::ostream &operator<<(std::ostream &os, const ObjJson &json)
 {
-	os << "{";
-	int n = json.kv_.size();
-	int i = 0;
+	using Entry = std::tuple<int, int, std::string, const Value *, const Value *>;
+	std::vector<Entry> entries;
+	entries.reserve(json.kv_.size());
 	for (const auto &[k, v] : json.kv_)
 	{
-		os << k << " : " << v;
-		if (i != n - 1)
+		int rank = k.is_nil() ? 0 : k.is_bool() ? 1 : k.is_number() ? 2 : k.is_obj_type<ObjString>() ? 3 : 4;
+		int number = k.is_bool() ? k.as<bool>() : k.is_number() ? k.as<int>() : 0;
+		std::ostringstream text;
+		if (rank > 2)
+			text << k;
+		entries.emplace_back(rank, number, text.str(), &k, &v);
+	}
+	std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b)
+			  { return std::tie(std::get<0>(a), std::get<1>(a), std::get<2>(a)) < std::tie(std::get<0>(b), std::get<1>(b), std::get<2>(b)); });
+	os << "{";
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		os << *std::get<3>(entries[i]) << " : " << *std::get<4>(entries[i]);
+		if (i != entries.size() - 1)
 			os << ", ";
-		i++;
 	}
 	os << "}";
 	return os;
@@ -135,13 +253,33 @@ std::ostream &operator<<(std::ostream &os, const Obj &obj)
 }
 
 ObjCoroutine::ObjCoroutine(ObjClosure *closure, const std::vector<Value>& arguments)
-	: Obj(ObjType::Coroutine), closure_(closure), stack_(1024), frames_(FRAMES_MAX), frame_count_(0), top_(0), status_(CoroutineStatus::SUSPENDED), arguments_(arguments)
+	: Obj(ObjType::Coroutine), closure_(closure), stack_(std::max(INITIAL_STACK, arguments.size() + 1)), frames_(INITIAL_FRAMES), frame_count_(0), top_(0), status_(CoroutineStatus::SUSPENDED), arguments_(arguments.begin(), arguments.end())
 {
-	CallFrame frame;
-	frame.closure_ = closure;
-	frame.ip_ = 0;
 	stack_[top_++] = Value();
 	for(auto arg = arguments.rbegin(); arg != arguments.rend(); arg++)
 		stack_[top_++] = *arg;
-	frames_[frame_count_++] = frame;
+	frames_[frame_count_++].init(closure, stack_.data());
+}
+
+void ObjCoroutine::grow_stack()
+{
+	decltype(stack_) stack(stack_.size() * 2);
+	std::copy_n(stack_.begin(), top_, stack.begin());
+	auto from = stack_.data();
+	auto to = stack.data();
+	for (int i = 0; i < frame_count_; i++)
+		frames_[i].slots_ = to + (frames_[i].slots_ - from);
+	for (auto upvalue = open_upvalues_; upvalue != nullptr; upvalue = upvalue->next_)
+		upvalue->location_ = to + (upvalue->location_ - from);
+	stack_.swap(stack);
+}
+
+void CallFrame::init(ObjClosure *closure, Value *slots)
+{
+	closure_ = closure;
+	ip_ = closure->function_->chunk_.bytecode_.data();
+	constants_ = closure->function_->chunk_.constants_.data();
+	caches_ = closure->function_->chunk_.caches_.data();
+	invoke_caches_ = closure->function_->chunk_.invoke_caches_.data();
+	slots_ = slots;
 }
@@ -11,22 +11,33 @@ template ObjString *create_obj_string(std::string&& str, VM &vm);
 template <typename T>
 ObjString *create_obj_string(T &&str, VM &vm)
 {
-	auto interned = vm.gc_.find_string(str);
+	auto hash = hash_string(str);
+	auto interned = vm.gc_.find_string(str, hash);
 	if (interned != nullptr)
+	{
+		vm.gc_.shade_interned(interned);
 		return interned;
+	}
 
-	auto p = alloc_unique_obj<ObjString>();
-	auto res = static_cast<ObjString *>(p.get());
-	if (vm.current_coroutine_ != nullptr)
-		vm.push(res);
+	auto res = alloc_obj<ObjString>();
 	res->content_ = std::forward<T>(str);
-	vm.gc_.strings_.emplace(res);
-	register_obj(std::move(p), vm.gc_);
-	if (vm.current_coroutine_ != nullptr)
-		vm.pop();
+	res->hash_ = hash;
+	vm.gc_.strings_.insert(res);
+	register_obj(res, vm.gc_);
 	return res;
 }
 
+uint32_t hash_string(std::string_view str) // FNV-1a
+{
+	uint32_t hash = 2166136261u;
+	for (auto c : str)
+	{
+		hash ^= static_cast<uint8_t>(c);
+		hash *= 16777619;
+	}
+	return hash;
+}
+
 std::ostream &operator<<(std::ostream &os, const ObjString &s)
 {
 	os << "\"" << s.text() << "\"";
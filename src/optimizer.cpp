@@ -0,0 +1,498 @@
+#include "optimizer.hpp"
+#include "object.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+Opcode first_component(Opcode op)
+{
+	switch (op)
+	{
+#define S(NAME, FIRST, ...) \
+	case NAME:              \
+		return FIRST;
+		SUPERINSTRUCTIONS
+#undef S
+	default:
+		return op;
+	}
+}
+
+int instruction_length(const Chunk &chunk, int offset)
+{
+	auto op = first_component(static_cast<Opcode>(chunk.bytecode_[offset]));
+	if (op >= FIRST_COMPARE_JUMP && op <= LAST_COMPARE_JUMP)
+		return 5;
+	if (op >= FIRST_REG_REG && op <= LAST_REG_CONST)
+		return 4;
+	switch (op)
+	{
+	case OP_CONSTANT:
+	case OP_GET_LOCAL:
+	case OP_SET_LOCAL:
+	case OP_GET_UPVALUE:
+	case OP_SET_UPVALUE:
+	case OP_CALL:
+	case OP_CLASS:
+	case OP_METHOD:
+	case OP_GET_SUPER:
+	case OP_ARRAY:
+	case OP_JSON:
+	case OP_FUNCTION:
+	case OP_CREATE_COROUTINE:
+	case OP_POPN:
+		return 2;
+	case OP_DEFINE_GLOBAL:
+	case OP_GET_GLOBAL:
+	case OP_SET_GLOBAL:
+	case OP_JUMP:
+	case OP_JUMP_IF_FALSE:
+	case OP_LOOP:
+	case OP_CONTINUE:
+	case OP_BREAK:
+	case OP_NEGATE_REG:
+	case OP_NOT_REG:
+	case OP_MOVE_REG:
+	case OP_LOAD_CONST:
+		return 3;
+	case OP_GET_PROPERTY:
+	case OP_SET_PROPERTY:
+		return 4;
+	case OP_INVOKE:
+	case OP_SUPER_INVOKE:
+		return 5;
+	case OP_CLOSURE:
+	{
+		auto function = chunk.constants_[chunk.bytecode_[offset + 1]].as_obj<ObjFunction>();
+		return 2 + 2 * function->upvalue_count_;
+	}
+	default:
+		return 1;
+	}
+}
+
+namespace
+{
+	struct Instruction
+	{
+		std::vector<uint8_t> bytes; // opcode, then its operands
+		int line = 0;
+		int target = -1; // jumps: index of the instruction they land on
+		bool removed = false;
+
+		Opcode op() const { return static_cast<Opcode>(bytes[0]); }
+		void set(Opcode op) { bytes = {static_cast<uint8_t>(op)}; }
+	};
+
+	bool is_conditional_jump(Opcode op)
+	{
+		return op == OP_JUMP_IF_FALSE || (op >= FIRST_COMPARE_JUMP && op <= LAST_COMPARE_JUMP);
+	}
+
+	bool is_unconditional_jump(Opcode op)
+	{
+		return op == OP_JUMP || op == OP_LOOP || op == OP_CONTINUE || op == OP_BREAK;
+	}
+
+	bool is_jump(Opcode op)
+	{
+		return is_conditional_jump(op) || is_unconditional_jump(op);
+	}
+
+	// pushes one value and has no other effect, so it can be dropped along with the OP_POP after it
+	bool is_pure_push(Opcode op)
+	{
+		return op == OP_CONSTANT || op == OP_NIL || op == OP_TRUE || op == OP_FALSE || op == OP_GET_LOCAL;
+	}
+
+	class Peephole
+	{
+	public:
+		explicit Peephole(Chunk &chunk) : chunk_(chunk) {}
+
+		bool decode()
+		{
+			auto size = static_cast<int>(chunk_.bytecode_.size());
+			std::vector<int> index_at(size + 1, -1);
+			for (int offset = 0; offset < size;)
+			{
+				auto length = instruction_length(chunk_, offset);
+				index_at[offset] = static_cast<int>(code_.size());
+				auto &instruction = code_.emplace_back();
+				instruction.bytes.assign(chunk_.bytecode_.begin() + offset, chunk_.bytecode_.begin() + offset + length);
+				instruction.line = chunk_.lines_[offset];
+				offset += length;
+			}
+			for (size_t i = 0, offset = 0; i < code_.size(); offset += code_[i++].bytes.size())
+			{
+				auto &instruction = code_[i];
+				if (!is_jump(instruction.op()))
+					continue;
+				auto length = instruction.bytes.size(); // the 16-bit jump operand always comes last
+				int operand = (instruction.bytes[length - 2] << 8) | instruction.bytes[length - 1];
+				int next = static_cast<int>(offset + length);
+				int to = instruction.op() == OP_LOOP ? next - operand : instruction.op() == OP_CONTINUE || instruction.op() == OP_BREAK ? operand : next + operand;
+				if (to < 0 || to >= size || index_at[to] == -1)
+					return false;
+				instruction.target = index_at[to];
+			}
+			return true;
+		}
+
+		void run()
+		{
+			for (bool changed = true; changed;)
+			{
+				find_leaders();
+				changed = false;
+				for (int i = 0; i < static_cast<int>(code_.size()); i++)
+					if (!code_[i].removed)
+						changed |= thread_jump(i) || fold(i) || fuse_not(i) || drop_dead_push(i);
+			}
+			find_leaders();
+			for (int i = 0; i < static_cast<int>(code_.size()); i++)
+				if (!code_[i].removed)
+					merge_pops(i);
+		}
+
+		bool encode()
+		{
+			std::vector<int> offset_of(code_.size() + 1);
+			int offset = 0;
+			for (size_t i = 0; i < code_.size(); i++)
+			{
+				offset_of[i] = offset;
+				if (!code_[i].removed)
+					offset += static_cast<int>(code_[i].bytes.size());
+			}
+			offset_of[code_.size()] = offset;
+
+			decltype(chunk_.bytecode_) bytecode;
+			decltype(chunk_.lines_) lines;
+			bytecode.reserve(offset);
+			lines.reserve(offset);
+			for (size_t i = 0; i < code_.size(); i++)
+			{
+				auto &instruction = code_[i];
+				if (instruction.removed)
+					continue;
+				if (instruction.target != -1)
+				{
+					auto length = instruction.bytes.size();
+					int next = offset_of[i] + static_cast<int>(length);
+					int to = offset_of[resolve(instruction.target)];
+					int operand = to;
+					if (instruction.op() == OP_JUMP || instruction.op() == OP_LOOP)
+					{
+						instruction.bytes[0] = to >= next ? OP_JUMP : OP_LOOP;
+						operand = to >= next ? to - next : next - to;
+					}
+					else if (is_conditional_jump(instruction.op()))
+						operand = to - next;
+					if (operand < 0 || operand > UINT16_MAX)
+						return false;
+					instruction.bytes[length - 2] = (operand >> 8) & 0xff;
+					instruction.bytes[length - 1] = operand & 0xff;
+				}
+				bytecode.insert(bytecode.end(), instruction.bytes.begin(), instruction.bytes.end());
+				lines.insert(lines.end(), instruction.bytes.size(), instruction.line);
+			}
+			chunk_.bytecode_.swap(bytecode);
+			chunk_.lines_.swap(lines);
+			return true;
+		}
+
+	private:
+		int next(int i) const
+		{
+			do
+				i++;
+			while (i < static_cast<int>(code_.size()) && code_[i].removed);
+			return i < static_cast<int>(code_.size()) ? i : -1;
+		}
+
+		int resolve(int i) const // a removed instruction's role as a target passes on to the next live one
+		{
+			return code_[i].removed ? next(i) : i;
+		}
+
+		void find_leaders()
+		{
+			leader_.assign(code_.size(), false);
+			for (auto &instruction : code_)
+				if (!instruction.removed && instruction.target != -1)
+					leader_[resolve(instruction.target)] = true;
+		}
+
+		void remove(int i)
+		{
+			code_[i].removed = true;
+			if (leader_[i])
+				leader_[next(i)] = true;
+		}
+
+		// the instruction after i, when control can only reach it from i
+		int follower(int i) const
+		{
+			auto j = next(i);
+			return j != -1 && !leader_[j] ? j : -1;
+		}
+
+		bool int_constant(int i, int &value) const
+		{
+			if (i == -1 || code_[i].op() != OP_CONSTANT)
+				return false;
+			auto &constant = chunk_.constants_[code_[i].bytes[1]];
+			if (!constant.is_number())
+				return false;
+			value = constant.as<int>();
+			return true;
+		}
+
+		bool set_constant(int i, int value)
+		{
+			auto &constants = chunk_.constants_;
+			size_t index = 0;
+			while (index < constants.size() && !(constants[index].is_number() && constants[index].as<int>() == value))
+				index++;
+			if (index > UINT8_MAX)
+				return false;
+			if (index == constants.size())
+				constants.push_back(Value(value));
+			code_[i].bytes = {OP_CONSTANT, static_cast<uint8_t>(index)};
+			return true;
+		}
+
+		bool thread_jump(int i)
+		{
+			auto &jump = code_[i];
+			if (jump.target == -1)
+				return false;
+			auto to = resolve(jump.target);
+			for (size_t hops = 0; hops < code_.size(); hops++)
+			{
+				auto &landing = code_[to];
+				bool passes = is_unconditional_jump(landing.op()) ||
+							  (jump.op() == OP_JUMP_IF_FALSE && landing.op() == OP_JUMP_IF_FALSE); // same value, same outcome
+				if (!passes || resolve(landing.target) == to)
+					break;
+				auto further = resolve(landing.target);
+				if (is_conditional_jump(jump.op()) && further <= i) // conditional jumps only go forward
+					break;
+				to = further;
+			}
+			if ((jump.op() == OP_JUMP || jump.op() == OP_JUMP_IF_FALSE) && to == next(i))
+			{
+				remove(i); // lands where it would fall through anyway
+				return true;
+			}
+			if (to == jump.target)
+				return false;
+			jump.target = to;
+			leader_[to] = true;
+			return true;
+		}
+
+		bool fold(int i)
+		{
+			int a, b;
+			auto op = code_[i].op();
+			if (op == OP_CONSTANT || op == OP_TRUE || op == OP_FALSE || op == OP_NIL)
+			{
+				auto j = follower(i);
+				if (j != -1 && code_[j].op() == OP_NOT)
+				{
+					code_[i].set(op == OP_FALSE || op == OP_NIL ? OP_TRUE : OP_FALSE); // constants are never falsey
+					code_[i].line = code_[j].line;
+					remove(j);
+					return true;
+				}
+				if (j != -1 && code_[j].op() == OP_JUMP_IF_FALSE)
+				{
+					if (op == OP_FALSE || op == OP_NIL)
+						code_[j].bytes[0] = OP_JUMP; // the value stays on the stack either way
+					else
+						remove(j);
+					return true;
+				}
+			}
+			if (!int_constant(i, a))
+				return false;
+			auto j = follower(i);
+			if (j != -1 && code_[j].op() == OP_NEGATE)
+			{
+				if (!set_constant(i, static_cast<int>(0u - static_cast<uint32_t>(a))))
+					return false;
+				code_[i].line = code_[j].line;
+				remove(j);
+				return true;
+			}
+			if (!int_constant(j, b))
+				return false;
+			auto k = follower(j);
+			if (k == -1)
+				return false;
+
+			auto wrap = [](int64_t value) { return static_cast<int>(static_cast<uint32_t>(value)); }; // as the VM's int arithmetic does
+			int result;
+			bool is_bool = false;
+			switch (code_[k].op())
+			{
+			case OP_ADD:
+				result = wrap(int64_t(a) + b);
+				break;
+			case OP_SUB:
+				result = wrap(int64_t(a) - b);
+				break;
+			case OP_MUL:
+				result = wrap(int64_t(a) * b);
+				break;
+			case OP_DIV:
+				if (b == 0 || (a == INT_MIN && b == -1)) // leave the fault to run time
+					return false;
+				result = a / b;
+				break;
+			case OP_EQUAL:
+				result = a == b, is_bool = true;
+				break;
+			case OP_NOT_EQUAL:
+				result = a != b, is_bool = true;
+				break;
+			case OP_LESS:
+				result = a < b, is_bool = true;
+				break;
+			case OP_LESS_EQUAL:
+				result = a <= b, is_bool = true;
+				break;
+			case OP_GREATER:
+				result = a > b, is_bool = true;
+				break;
+			case OP_GREATER_EQUAL:
+				result = a >= b, is_bool = true;
+				break;
+			default:
+				return false;
+			}
+			if (is_bool)
+				code_[i].set(result ? OP_TRUE : OP_FALSE);
+			else if (!set_constant(i, result))
+				return false;
+			code_[i].line = code_[k].line;
+			remove(j);
+			remove(k);
+			return true;
+		}
+
+		bool fuse_not(int i)
+		{
+			auto op = code_[i].op();
+			if (op != OP_EQUAL && op != OP_LESS && op != OP_GREATER)
+				return false;
+			auto j = follower(i);
+			if (j == -1 || code_[j].op() != OP_NOT)
+				return false;
+			code_[i].set(op == OP_EQUAL ? OP_NOT_EQUAL : op == OP_LESS ? OP_GREATER_EQUAL : OP_LESS_EQUAL);
+			remove(j);
+			return true;
+		}
+
+		bool drop_dead_push(int i)
+		{
+			if (!is_pure_push(code_[i].op()))
+				return false;
+			auto j = follower(i);
+			if (j == -1 || code_[j].op() != OP_POP)
+				return false;
+			remove(i);
+			remove(j);
+			return true;
+		}
+
+		void merge_pops(int i)
+		{
+			if (code_[i].op() != OP_POP)
+				return;
+			int count = 1;
+			for (auto j = follower(i); j != -1 && code_[j].op() == OP_POP && count < UINT8_MAX; j = follower(j))
+			{
+				remove(j);
+				count++;
+			}
+			if (count > 1)
+				code_[i].bytes = {OP_POPN, static_cast<uint8_t>(count)};
+		}
+
+		Chunk &chunk_;
+		std::vector<Instruction> code_;
+		std::vector<bool> leader_; // jumped to, so a pattern can start but not continue there
+	};
+}
+
+#ifndef PROFILE_OPCODES // the profile counts runs of plain opcodes
+namespace
+{
+	struct Superinstruction
+	{
+		Opcode op;
+		std::vector<Opcode> components;
+	};
+
+	const std::vector<Superinstruction> &superinstructions() // longest first
+	{
+		static const std::vector<Superinstruction> all = []
+		{
+			std::vector<Superinstruction> list = {
+#define S(NAME, ...) {NAME, {__VA_ARGS__}},
+				SUPERINSTRUCTIONS
+#undef S
+			};
+			std::stable_sort(list.begin(), list.end(), [](auto &a, auto &b)
+							 { return a.components.size() > b.components.size(); });
+			return list;
+		}();
+		return all;
+	}
+
+	void fuse_superinstructions(Chunk &chunk)
+	{
+		auto &code = chunk.bytecode_;
+		auto size = static_cast<int>(code.size());
+		for (int offset = 0; offset < size;)
+		{
+			int length = 0;
+			for (auto &super : superinstructions())
+			{
+				int end = offset;
+				size_t matched = 0;
+				while (matched < super.components.size() && end < size && code[end] == super.components[matched])
+				{
+					end += instruction_length(chunk, end);
+					matched++;
+				}
+				if (matched == super.components.size())
+				{
+					code[offset] = super.op;
+					length = end - offset;
+					break;
+				}
+			}
+			offset += length != 0 ? length : instruction_length(chunk, offset);
+		}
+	}
+}
+#endif
+
+void optimize_chunk(Chunk &chunk)
+{
+	Peephole peephole(chunk);
+	if (!peephole.decode())
+		return;
+	auto constants = chunk.constants_.size(); // folding appends constants that only the rewritten code uses
+	peephole.run();
+	if (!peephole.encode())
+		chunk.constants_.resize(constants);
+#ifndef PROFILE_OPCODES
+	fuse_superinstructions(chunk);
+#endif
+}
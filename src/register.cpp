@@ -0,0 +1,423 @@
+#include "compiler.hpp"
+#include "objstring.hpp"
+#include "vm.hpp"
+#include <string>
+
+// The register backend of Complication. Locals already have a slot each in the frame, so they serve as the
+// registers: a three-address instruction reads its operands from their slots and writes its result to a
+// slot, where the stack code would push both operands with OP_GET_LOCAL, pop them again and, for an
+// assignment, store with OP_SET_LOCAL and pop. Intermediate results go to temporaries, slots above the
+// locals, which the instruction that writes one past the top of the stack pushes. Statements keep their
+// stack effect: an expression statement leaves nothing behind, print/return/var leave the value on top.
+
+namespace
+{
+    using Kind = RegisterExpr::Kind;
+
+    // indices into OP_*_REG_REG/OP_*_REG_CONST, in their order
+    enum ThreeAddress
+    {
+        ADD,
+        SUB,
+        MUL,
+        DIV,
+        EQUAL,
+        LESS,
+        GREATER
+    };
+
+    constexpr Opcode STACK_OPCODES[] = {OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_EQUAL, OP_LESS, OP_GREATER};
+
+    // the instruction for a binary operator, and whether its result is negated after, as binary() emits
+    // a != b as OP_EQUAL, OP_NOT; -1 for an operator the backend leaves to the stack code
+    int three_address(TokenType type, bool &negated)
+    {
+        negated = type == TOKEN_BANG_EQUAL || type == TOKEN_GREATER_EQUAL || type == TOKEN_LESS_EQUAL;
+        switch (type)
+        {
+        case TOKEN_PLUS:
+            return ADD;
+        case TOKEN_MINUS:
+            return SUB;
+        case TOKEN_STAR:
+            return MUL;
+        case TOKEN_SLASH:
+            return DIV;
+        case TOKEN_EQUAL_EQUAL:
+        case TOKEN_BANG_EQUAL:
+            return EQUAL;
+        case TOKEN_LESS:
+        case TOKEN_GREATER_EQUAL:
+            return LESS;
+        case TOKEN_GREATER:
+        case TOKEN_LESS_EQUAL:
+            return GREATER;
+        default:
+            return -1;
+        }
+    }
+
+    bool assigns_local(const RegisterExpr &node, int slot)
+    {
+        if (node.kind_ == Kind::Assign && node.target_ == Kind::Local && node.index_ == slot)
+            return true;
+        return (node.left_ != nullptr && assigns_local(*node.left_, slot)) ||
+               (node.right_ != nullptr && assigns_local(*node.right_, slot));
+    }
+}
+
+std::unique_ptr<RegisterExpr> Complication::register_expression()
+{
+    if (backend_ != Backend::Register)
+        return nullptr;
+    auto &scanner = parser_->scanner_;
+    auto start = scanner.start, current = scanner.current;
+    int line = scanner.line;
+    Token currentToken = parser_->current_, previousToken = parser_->previous_;
+    auto constants = current_chunk()->constants_.size();
+
+    int nodes = 0;
+    auto tree = parse_register(PREC_ASSIGNMENT, nodes);
+    if (tree != nullptr && current_->local_count_ + 2 * nodes < UINT8_MAX) // each node takes a temporary at most, and a constant operand that goes first another
+        return tree;
+
+    // the stack code parses it again; an error on the way stays reported once, as panic_mode_ is set
+    scanner.start = start;
+    scanner.current = current;
+    scanner.line = line;
+    parser_->current_ = currentToken;
+    parser_->previous_ = previousToken;
+    current_chunk()->constants_.resize(constants);
+    return nullptr;
+}
+
+// mirrors parse_precedence
+std::unique_ptr<RegisterExpr> Complication::parse_register(Precedence precedence, int &nodes)
+{
+    advance();
+    bool canAssign = precedence <= PREC_ASSIGNMENT;
+    auto left = register_prefix(canAssign, nodes);
+    while (left != nullptr && precedence <= get_rule_.at(parser_->current_.type).precedence_)
+    {
+        advance();
+        auto node = std::make_unique<RegisterExpr>();
+        node->kind_ = Kind::Binary;
+        node->operator_ = parser_->previous_.type;
+        bool negated;
+        if (three_address(node->operator_, negated) == -1)
+            return nullptr;
+        node->left_ = std::move(left);
+        node->right_ = parse_register(static_cast<Precedence>(get_rule_.at(node->operator_).precedence_ + 1), nodes);
+        if (node->right_ == nullptr)
+            return nullptr;
+        node->line_ = parser_->previous_.line;
+        nodes++;
+        left = std::move(node);
+    }
+    if (canAssign && check(TOKEN_EQUAL))
+        return nullptr; // the stack code reports it
+    return left;
+}
+
+std::unique_ptr<RegisterExpr> Complication::register_prefix(bool canAssign, int &nodes)
+{
+    auto node = std::make_unique<RegisterExpr>();
+    switch (parser_->previous_.type)
+    {
+    case TOKEN_NUMBER:
+        node->kind_ = Kind::Constant;
+        node->index_ = make_constant(std::stoi(std::string(parser_->previous_.string)));
+        break;
+    case TOKEN_STRING:
+    {
+        std::string_view text = parser_->previous_.string;
+        node->kind_ = Kind::Constant;
+        node->index_ = make_constant(create_obj_string(text.substr(1, text.size() - 2), vm_));
+        break;
+    }
+    case TOKEN_NIL:
+        node->kind_ = Kind::Nil;
+        break;
+    case TOKEN_TRUE:
+        node->kind_ = Kind::True;
+        break;
+    case TOKEN_FALSE:
+        node->kind_ = Kind::False;
+        break;
+    case TOKEN_IDENTIFIER: // as name_variable resolves it
+    {
+        Token name = parser_->previous_;
+        Kind kind = Kind::Local;
+        int arg = resolve_local(current_, name);
+        if (arg == -1 && (arg = resolve_upvalue(current_, name)) != -1)
+            kind = Kind::Upvalue;
+        else if (arg == -1)
+        {
+            arg = global_slot(name);
+            kind = Kind::Global;
+        }
+        node->kind_ = kind;
+        node->index_ = arg;
+        if (canAssign && match(TOKEN_EQUAL))
+        {
+            node->kind_ = Kind::Assign;
+            node->target_ = kind;
+            node->right_ = parse_register(PREC_ASSIGNMENT, nodes);
+            if (node->right_ == nullptr)
+                return nullptr;
+        }
+        break;
+    }
+    case TOKEN_LEFT_PAREN:
+    {
+        auto inner = parse_register(PREC_ASSIGNMENT, nodes);
+        if (inner != nullptr)
+            consume(TOKEN_RIGHT_PAREN, "No right paren.");
+        return inner;
+    }
+    case TOKEN_MINUS:
+    case TOKEN_BANG: // the operand is a whole expression, as unary() parses it
+        node->kind_ = Kind::Unary;
+        node->operator_ = parser_->previous_.type;
+        node->right_ = parse_register(PREC_ASSIGNMENT, nodes);
+        if (node->right_ == nullptr)
+            return nullptr;
+        break;
+    default:
+        return nullptr;
+    }
+    node->line_ = parser_->previous_.line;
+    nodes++;
+    return node;
+}
+
+void Complication::emit_register_effect(const RegisterExpr &tree)
+{
+    int line = parser_->previous_.line;
+    register_top_ = current_->local_count_;
+    auto result = emit_register(tree);
+    parser_->previous_.line = line;
+    if (result.kind_ == Operand::Kind::Temp)
+        emit_byte(OP_POP);
+}
+
+void Complication::emit_register_value(const RegisterExpr &tree, int top)
+{
+    int line = parser_->previous_.line;
+    register_top_ = top;
+    emit_register_push(emit_register(tree));
+    parser_->previous_.line = line;
+}
+
+int Complication::emit_register_condition(const RegisterExpr &tree, int conditionStart, bool &fused)
+{
+    int line = parser_->previous_.line;
+    register_top_ = current_->local_count_;
+    bool negated = false;
+    int index = tree.kind_ == Kind::Binary ? three_address(tree.operator_, negated) : -1;
+    if (index < EQUAL)
+        emit_register_push(emit_register(tree));
+    else
+    {
+        auto left = emit_register(*tree.left_);
+        if (left.kind_ == Operand::Kind::Register && assigns_local(*tree.right_, left.index_))
+            left = emit_register_push(left);
+        auto right = emit_register(*tree.right_);
+        bool localFirst = left.kind_ == Operand::Kind::Register && right.kind_ != Operand::Kind::Temp;
+        bool constantFirst = left.kind_ == Operand::Kind::Constant && right.kind_ == Operand::Kind::Register;
+        parser_->previous_.line = line;
+        if (localFirst || constantFirst) // compare and jump in one instruction, as emit_condition_jump fuses it
+        {
+            fused = true;
+            auto compare = STACK_OPCODES[index];
+            if (localFirst)
+                return emit_compare_jump(compare, negated, left.index_, right.index_, right.kind_ == Operand::Kind::Constant);
+            compare = compare == OP_LESS ? OP_GREATER : compare == OP_GREATER ? OP_LESS : compare; // k < a is a > k
+            return emit_compare_jump(compare, negated, right.index_, left.index_, true);
+        }
+        parser_->previous_.line = tree.line_;
+        emit_three_address(index, left, right, -1);
+        if (negated)
+            emit_byte(OP_NOT);
+    }
+    parser_->previous_.line = line;
+    return emit_condition_jump(conditionStart, fused);
+}
+
+// emit_byte attributes code to the line of the last token parsed, which stands at the end of the
+// statement by now, so each node points it back at its own
+Operand Complication::emit_register(const RegisterExpr &node)
+{
+    parser_->previous_.line = node.line_;
+    switch (node.kind_)
+    {
+    case Kind::Constant:
+        return {Operand::Kind::Constant, static_cast<uint8_t>(node.index_)};
+    case Kind::Local:
+        return {Operand::Kind::Register, static_cast<uint8_t>(node.index_)};
+    case Kind::Nil:
+        emit_byte(OP_NIL);
+        break;
+    case Kind::True:
+        emit_byte(OP_TRUE);
+        break;
+    case Kind::False:
+        emit_byte(OP_FALSE);
+        break;
+    case Kind::Upvalue:
+        emit_bytes(OP_GET_UPVALUE, node.index_);
+        break;
+    case Kind::Global:
+        emit_short(OP_GET_GLOBAL, node.index_);
+        break;
+    case Kind::Unary:
+        return emit_register_unary(node, -1);
+    case Kind::Binary:
+        return emit_register_binary(node, -1);
+    case Kind::Assign:
+    {
+        if (node.target_ == Kind::Local)
+            return emit_register_into(*node.right_, node.index_);
+        emit_register_push(emit_register(*node.right_));
+        parser_->previous_.line = node.line_;
+        if (node.target_ == Kind::Global)
+            emit_short(OP_SET_GLOBAL, node.index_);
+        else
+            emit_bytes(OP_SET_UPVALUE, node.index_);
+        return {Operand::Kind::Temp, static_cast<uint8_t>(register_top_ - 1)};
+    }
+    }
+    return {Operand::Kind::Temp, static_cast<uint8_t>(register_top_++)};
+}
+
+Operand Complication::emit_register_into(const RegisterExpr &node, int slot)
+{
+    switch (node.kind_)
+    {
+    case Kind::Unary:
+        return emit_register_unary(node, slot);
+    case Kind::Binary:
+        return emit_register_binary(node, slot);
+    default:
+        return emit_register_move(emit_register(node), slot);
+    }
+}
+
+Operand Complication::emit_register_unary(const RegisterExpr &node, int slot)
+{
+    auto operand = emit_register(*node.right_);
+    parser_->previous_.line = node.line_;
+    if (operand.kind_ != Operand::Kind::Register)
+    {
+        emit_register_push(operand);
+        emit_byte(node.operator_ == TOKEN_MINUS ? OP_NEGATE : OP_NOT);
+        return emit_register_move({Operand::Kind::Temp, static_cast<uint8_t>(register_top_ - 1)}, slot);
+    }
+    int target = slot != -1 ? slot : register_top_++;
+    emit_bytes(node.operator_ == TOKEN_MINUS ? OP_NEGATE_REG : OP_NOT_REG, target);
+    emit_byte(operand.index_);
+    return {slot != -1 ? Operand::Kind::Register : Operand::Kind::Temp, static_cast<uint8_t>(target)};
+}
+
+Operand Complication::emit_register_binary(const RegisterExpr &node, int slot)
+{
+    bool negated;
+    int index = three_address(node.operator_, negated);
+    auto left = emit_register(*node.left_);
+    if (left.kind_ == Operand::Kind::Register && assigns_local(*node.right_, left.index_))
+        left = emit_register_push(left); // read it before the right operand assigns it
+    auto right = emit_register(*node.right_);
+    parser_->previous_.line = node.line_;
+    if (!negated)
+        return emit_three_address(index, left, right, slot);
+    emit_three_address(index, left, right, -1);
+    emit_byte(OP_NOT);
+    return emit_register_move({Operand::Kind::Temp, static_cast<uint8_t>(register_top_ - 1)}, slot);
+}
+
+// left `index` right, written to the local in slot or, when slot is -1, to a temporary
+Operand Complication::emit_three_address(int index, Operand left, Operand right, int slot)
+{
+    using K = Operand::Kind;
+    if ((left.kind_ == K::Constant && right.kind_ == K::Constant) || // stack code, which the peephole pass folds
+        (left.kind_ == K::Temp && right.kind_ == K::Temp && slot == -1)) // both on the stack already
+    {
+        emit_register_push(left);
+        emit_register_push(right);
+        emit_byte(STACK_OPCODES[index]);
+        register_top_--;
+        return emit_register_move({K::Temp, static_cast<uint8_t>(register_top_ - 1)}, slot);
+    }
+    if (left.kind_ == K::Constant)
+    {
+        if (index == MUL || index == EQUAL) // k * a is a * k; + concatenates in order, so it stays
+            std::swap(left, right);
+        else if (index == LESS || index == GREATER) // k < a is a > k
+        {
+            std::swap(left, right);
+            index = index == LESS ? GREATER : LESS;
+        }
+        else
+        {
+            emit_bytes(OP_LOAD_CONST, register_top_);
+            emit_byte(left.index_);
+            left = {K::Temp, static_cast<uint8_t>(register_top_++)};
+        }
+    }
+
+    int lowest = -1; // the temporaries from lowest up are dead once the instruction has read them
+    if (left.kind_ == K::Temp)
+        lowest = left.index_;
+    if (right.kind_ == K::Temp && (lowest == -1 || right.index_ < lowest))
+        lowest = right.index_;
+    int target = slot != -1 ? slot : lowest != -1 ? lowest : register_top_;
+    emit_bytes((right.kind_ == K::Constant ? FIRST_REG_CONST : FIRST_REG_REG) + index, target);
+    emit_bytes(left.index_, right.index_);
+
+    int top = slot != -1 ? (lowest != -1 ? lowest : register_top_) : target + 1;
+    for (; register_top_ > top; register_top_--)
+        emit_byte(OP_POP);
+    register_top_ = top;
+    return {slot != -1 ? K::Register : K::Temp, static_cast<uint8_t>(target)};
+}
+
+// value into the local in slot; slot -1 leaves it where it is
+Operand Complication::emit_register_move(Operand value, int slot)
+{
+    if (slot == -1 || (value.kind_ == Operand::Kind::Register && value.index_ == slot))
+        return value;
+    switch (value.kind_)
+    {
+    case Operand::Kind::Register:
+        emit_bytes(OP_MOVE_REG, slot);
+        emit_byte(value.index_);
+        break;
+    case Operand::Kind::Constant:
+        emit_bytes(OP_LOAD_CONST, slot);
+        emit_byte(value.index_);
+        break;
+    case Operand::Kind::Temp: // the topmost
+        emit_bytes(OP_SET_LOCAL, slot);
+        emit_byte(OP_POP);
+        register_top_--;
+        break;
+    }
+    return {Operand::Kind::Register, static_cast<uint8_t>(slot)};
+}
+
+// value as a temporary on top of the stack
+Operand Complication::emit_register_push(Operand value)
+{
+    switch (value.kind_)
+    {
+    case Operand::Kind::Register:
+        emit_bytes(OP_GET_LOCAL, value.index_);
+        break;
+    case Operand::Kind::Constant:
+        emit_bytes(OP_CONSTANT, value.index_);
+        break;
+    case Operand::Kind::Temp:
+        return value;
+    }
+    return {Operand::Kind::Temp, static_cast<uint8_t>(register_top_++)};
+}
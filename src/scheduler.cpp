@@ -1,44 +1,125 @@
 #include "scheduler.hpp"
 #include "common.hpp"
 #include "vm.hpp"
+#include <algorithm>
 
-void Scheduler::addObjCoroutine(ObjCoroutine *coroutine)
+void Scheduler::enqueue(ObjCoroutine *coroutine)
 {
-    coroutines_.push_back(coroutine);
+    auto level = policy_ == SchedulePolicy::Priority ? coroutine->priority_ : 0;
+    auto &list = ready_[level];
+    coroutine->ready_ = true;
+    coroutine->next_ready_ = nullptr;
+    coroutine->prev_ready_ = list.tail;
+    if (list.tail != nullptr)
+        list.tail->next_ready_ = coroutine;
+    else
+        list.head = coroutine;
+    list.tail = coroutine;
+    ready_mask_ |= 1u << level;
+}
+
+void Scheduler::unlink(ObjCoroutine *coroutine)
+{
+    auto level = policy_ == SchedulePolicy::Priority ? coroutine->priority_ : 0;
+    auto &list = ready_[level];
+    (coroutine->prev_ready_ != nullptr ? coroutine->prev_ready_->next_ready_ : list.head) = coroutine->next_ready_;
+    (coroutine->next_ready_ != nullptr ? coroutine->next_ready_->prev_ready_ : list.tail) = coroutine->prev_ready_;
+    coroutine->next_ready_ = coroutine->prev_ready_ = nullptr;
+    coroutine->ready_ = false;
+    if (list.head == nullptr)
+        ready_mask_ &= ~(1u << level);
+}
+
+ObjCoroutine *Scheduler::pop_ready()
+{
+    if (ready_mask_ == 0)
+        return nullptr;
+    auto co = ready_[31 - __builtin_clz(ready_mask_)].head;
+    unlink(co);
+    return co;
+}
+
+void Scheduler::switch_to(ObjCoroutine *coroutine)
+{
+    auto previous = current_coroutine_;
+    if (previous != nullptr && previous != coroutine && previous->status_ != CoroutineStatus::FINISHED)
+        vm.gc_.switched_out(previous);
+    current_coroutine_ = vm.current_coroutine_ = coroutine;
+    coroutine->status_ = CoroutineStatus::RUNNING;
+}
+
+ObjCoroutine *Scheduler::take_resumer(ObjCoroutine *coroutine)
+{
+    auto resumer = coroutine->resumer_;
+    coroutine->resumer_ = nullptr;
+    if (resumer != nullptr && resumer->status_ == CoroutineStatus::SUSPENDED && !resumer->ready_)
+        return resumer;
+    return nullptr;
 }
 
-InterpretResult Scheduler::runNextObjCoroutine()
+void Scheduler::spawnCoroutine(ObjCoroutine *coroutine, int priority)
 {
-    return resumeCoroutine(main_coroutine);
+    if (coroutine->status_ != CoroutineStatus::SUSPENDED || coroutine->ready_)
+        return;
+    coroutine->priority_ = static_cast<uint8_t>(std::clamp(priority, 0, PRIORITY_LEVELS - 1));
+    coroutine->spawned_ = true;
+    enqueue(coroutine);
+}
+
+void Scheduler::resumeCoroutine(ObjCoroutine *coroutine)
+{
+    if (coroutine->status_ != CoroutineStatus::SUSPENDED)
+        return;
+    for (auto waiting = current_coroutine_->resumer_; waiting != nullptr; waiting = waiting->resumer_)
+        if (waiting == coroutine)
+            return; // suspended in resume itself: it would forget its resumer, and the chain would loop
+    if (coroutine->ready_)
+        unlink(coroutine);
+    coroutine->resumer_ = current_coroutine_;
+    vm.gc_.write_barrier(coroutine, current_coroutine_);
+    current_coroutine_->status_ = CoroutineStatus::SUSPENDED;
+    switch_to(coroutine);
 }
 
 void Scheduler::yieldCurrentObjCoroutine()
 {
-    if (current_coroutine_->status_ == CoroutineStatus::FINISHED)
-    {
-        ;
-    }
-    else
-    {
-        current_coroutine_->status_ = CoroutineStatus::SUSPENDED;
-        addObjCoroutine(current_coroutine_);
-    }
+    auto co = current_coroutine_;
+    co->status_ = CoroutineStatus::SUSPENDED;
+    auto next = take_resumer(co);
+    if (co->spawned_)
+        enqueue(co); // before picking, so it runs again if nothing else is ready at its priority or above
+    if (next == nullptr)
+        next = pop_ready();
+    if (next == nullptr)
+        next = co; // a resumed coroutine whose resumer is gone, with nothing ready: it carries on
+    switch_to(next);
+}
+
+bool Scheduler::finishCurrentObjCoroutine()
+{
+    auto co = current_coroutine_;
+    co->status_ = CoroutineStatus::FINISHED;
+    auto next = take_resumer(co);
+    if (next == nullptr)
+        next = pop_ready();
+    if (next == nullptr)
+        return false;
+    switch_to(next);
+    return true;
 }
 
-InterpretResult Scheduler::resumeCoroutine(ObjCoroutine *coroutine)
+InterpretResult Scheduler::start(ObjCoroutine *main)
 {
-    if (coroutine->status_ == CoroutineStatus::SUSPENDED)
+    main_coroutine = main;
+    main->spawned_ = true;
+    switch_to(main);
+    auto result = vm.run(main);
+    while (result == INTERPRET_RUNTIME_ERROR && current_coroutine_ != main_coroutine)
     {
-        current_coroutine_ = coroutine;
-        current_coroutine_->status_ = CoroutineStatus::RUNNING;
-        for (auto it = coroutines_.begin(); it != coroutines_.end(); it++)
-            if (*it == coroutine)
-            {
-                coroutines_.erase(it);
-                break;
-            }
-        return vm.run(coroutine); // Resume coroutine execution
+        // whoever resumed the failed coroutine, or the next ready one, goes on from where it left off
+        if (!finishCurrentObjCoroutine())
+            return INTERPRET_OK;
+        result = vm.run(current_coroutine_);
     }
-    else
-        return INTERPRET_RUNTIME_ERROR;
-}
\ No newline at end of file
+    return result;
+}
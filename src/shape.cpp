@@ -0,0 +1,50 @@
+#include "shape.hpp"
+#include "memory.hpp"
+
+static thread_local uint32_t next_shape_id = 1; // 0 marks an empty inline cache; caches never leave their thread's VM
+
+void ShapeDeleter::operator()(Shape *shape) const
+{
+	Allocator<Shape> alloc;
+	std::allocator_traits<Allocator<Shape>>::destroy(alloc, shape);
+	alloc.deallocate(shape, 1);
+}
+
+ShapePtr make_shape(Shape *parent, ObjString *name)
+{
+	Allocator<Shape> alloc;
+	auto shape = alloc.allocate(1);
+	std::allocator_traits<Allocator<Shape>>::construct(alloc, shape, parent, name);
+	return ShapePtr(shape);
+}
+
+Shape::Shape(Shape *parent, ObjString *name)
+	: id_(next_shape_id++), parent_(parent), name_(name)
+{
+}
+
+int Shape::find(ObjString *name) const
+{
+	auto slot = slots_.find(name);
+	return slot == nullptr ? -1 : slot->as<int>();
+}
+
+Shape *Shape::transition(ObjString *name)
+{
+	for (auto &next : transitions_)
+		if (next->name_ == name)
+			return next.get();
+
+	auto next = transitions_.emplace_back(make_shape(this, name)).get();
+	next->slots_.add_all(slots_);
+	next->slots_.set(name, static_cast<int>(field_count()));
+	return next;
+}
+
+size_t Shape::footprint() const
+{
+	auto bytes = sizeof(Shape) + slots_.capacity() * sizeof(Table::Entry) + transitions_.capacity() * sizeof(ShapePtr);
+	for (auto &next : transitions_)
+		bytes += next->footprint();
+	return bytes;
+}
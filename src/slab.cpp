@@ -0,0 +1,115 @@
+#include "slab.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace slab
+{
+	static Page *new_page(size_t index)
+	{
+		auto memory = std::aligned_alloc(PAGE_SIZE, PAGE_SIZE);
+		if (memory == nullptr)
+			throw std::bad_alloc();
+
+		auto page = new (memory) Page();
+		auto base = static_cast<char *>(memory);
+		auto block_size = (index + 1) * GRANULE;
+		page->bump = base + (sizeof(Page) + GRANULE - 1) / GRANULE * GRANULE;
+		page->end = page->bump + (base + PAGE_SIZE - page->bump) / block_size * block_size;
+		page->size_class = static_cast<uint32_t>(index);
+
+		auto &size_class = classes[index];
+		page->next_page = size_class.pages;
+		size_class.pages = page;
+		return page;
+	}
+
+	void *refill(size_t index)
+	{
+		auto &size_class = classes[index];
+		if (size_class.current != nullptr)
+			size_class.current->queued = false; // full: its next free queues it again
+		size_class.current = nullptr;
+
+		while (size_class.partial != nullptr)
+		{
+			auto page = size_class.partial;
+			size_class.partial = page->next_partial;
+			if (page->free != nullptr || page->bump != page->end)
+			{
+				size_class.current = page;
+				break;
+			}
+			page->queued = false;
+		}
+		if (size_class.current == nullptr)
+			size_class.current = new_page(index);
+		size_class.current->queued = true;
+		return allocate((index + 1) * GRANULE);
+	}
+
+	void free_remote(void *p)
+	{
+		auto block = static_cast<Block *>(p);
+		auto page = page_of(p);
+		block->next = page->remote_free;
+		if (page->remote_free == nullptr)
+			page->remote_tail = block;
+		page->remote_free = block;
+		page->remote_count++;
+	}
+
+	void release_empty_pages()
+	{
+		for (auto &size_class : classes)
+		{
+			size_class.partial = nullptr;
+			auto link = &size_class.pages;
+			while (auto page = *link)
+			{
+				if (page->remote_free != nullptr)
+				{
+					page->remote_tail->next = page->free;
+					page->free = page->remote_free;
+					page->used -= page->remote_count;
+					page->remote_free = page->remote_tail = nullptr;
+					page->remote_count = 0;
+				}
+				if (page == size_class.current)
+				{
+					link = &page->next_page;
+					continue;
+				}
+				if (page->used == 0)
+				{
+					*link = page->next_page;
+					std::free(page);
+					continue;
+				}
+				page->queued = page->free != nullptr || page->bump != page->end;
+				if (page->queued)
+				{
+					page->next_partial = size_class.partial;
+					size_class.partial = page;
+				}
+				link = &page->next_page;
+			}
+		}
+	}
+
+	void release_thread_pages()
+	{
+		release_empty_pages();
+		for (auto &size_class : classes)
+		{
+			auto page = size_class.current;
+			if (page == nullptr || page->used != 0)
+				continue;
+			auto link = &size_class.pages;
+			while (*link != page)
+				link = &(*link)->next_page;
+			*link = page->next_page;
+			size_class.current = nullptr;
+			std::free(page);
+		}
+	}
+}
@@ -0,0 +1,209 @@
+#include "table.hpp"
+#include "memory.hpp"
+#include "objstring.hpp"
+
+constexpr auto TABLE_MAX_LOAD = 0.75;
+constexpr size_t TABLE_MIN_CAPACITY = 8;
+
+Table::~Table()
+{
+	if (entries_ != nullptr)
+		Allocator<Entry>().deallocate(entries_, capacity_);
+}
+
+Table::Entry *Table::find_entry(ObjString *key) const
+{
+	size_t mask = capacity_ - 1;
+	Entry *tombstone = nullptr;
+	for (size_t index = key->hash_ & mask;; index = (index + 1) & mask) // load factor keeps at least one empty slot
+	{
+		Entry *entry = &entries_[index];
+		if (entry->key == key)
+			return entry;
+		if (entry->key == nullptr)
+		{
+			if (entry->value.is_nil())
+				return tombstone != nullptr ? tombstone : entry;
+			if (tombstone == nullptr)
+				tombstone = entry;
+		}
+	}
+}
+
+Value *Table::find(ObjString *key) const
+{
+	if (size() == 0)
+		return nullptr;
+	Entry *entry = find_entry(key);
+	return entry->key == nullptr ? nullptr : &entry->value;
+}
+
+bool Table::get(ObjString *key, Value &value) const
+{
+	auto found = find(key);
+	if (found == nullptr)
+		return false;
+	value = *found;
+	return true;
+}
+
+bool Table::set(ObjString *key, const Value &value)
+{
+	if (count_ + 1 > capacity_ * TABLE_MAX_LOAD)
+	{
+		auto capacity = std::max(capacity_, TABLE_MIN_CAPACITY);
+		if (tombstones_ * 2 < count_) // mostly live entries: grow, otherwise rehash in place
+			capacity *= 2;
+		adjust_capacity(capacity);
+	}
+
+	Entry *entry = find_entry(key);
+	bool is_new = entry->key == nullptr;
+	if (is_new)
+	{
+		if (entry->value.is_nil())
+			count_++;
+		else
+			tombstones_--;
+	}
+	entry->key = key;
+	entry->value = value;
+	return is_new;
+}
+
+bool Table::remove(ObjString *key)
+{
+	if (size() == 0)
+		return false;
+	Entry *entry = find_entry(key);
+	if (entry->key == nullptr)
+		return false;
+	entry->key = nullptr;
+	entry->value = Value(true);
+	tombstones_++;
+	return true;
+}
+
+void Table::add_all(const Table &from)
+{
+	for (auto &[key, value] : from)
+		set(key, value);
+}
+
+void Table::adjust_capacity(size_t capacity)
+{
+	auto entries = Allocator<Entry>().allocate(capacity);
+	std::uninitialized_fill_n(entries, capacity, Entry());
+
+	auto old_entries = entries_;
+	auto old_capacity = capacity_;
+	entries_ = entries;
+	capacity_ = capacity;
+	count_ = tombstones_ = 0;
+
+	for (size_t i = 0; i < old_capacity; i++)
+	{
+		auto &entry = old_entries[i];
+		if (entry.key != nullptr)
+		{
+			auto dest = find_entry(entry.key);
+			*dest = entry;
+			count_++;
+		}
+	}
+	if (old_entries != nullptr)
+		Allocator<Entry>().deallocate(old_entries, old_capacity);
+}
+
+StringTable::~StringTable()
+{
+	if (entries_ != nullptr)
+		Allocator<ObjString *>().deallocate(entries_, capacity_);
+}
+
+ObjString *StringTable::find(std::string_view str, uint32_t hash) const
+{
+	if (count_ == 0)
+		return nullptr;
+	size_t mask = capacity_ - 1;
+	for (size_t index = hash & mask;; index = (index + 1) & mask) // load factor keeps at least one empty slot
+	{
+		ObjString *entry = entries_[index];
+		if (entry == nullptr)
+			return nullptr;
+		if (entry != TOMBSTONE && entry->hash_ == hash && entry->text() == str)
+			return entry;
+	}
+}
+
+void StringTable::insert(ObjString *str)
+{
+	if (count_ + 1 > capacity_ * TABLE_MAX_LOAD)
+	{
+		auto capacity = std::max(capacity_, TABLE_MIN_CAPACITY);
+		if (tombstones_ * 2 < count_) // mostly live entries: grow, otherwise rehash in place
+			capacity *= 2;
+		adjust_capacity(capacity);
+	}
+
+	size_t mask = capacity_ - 1;
+	size_t index = str->hash_ & mask;
+	while (entries_[index] != nullptr && entries_[index] != TOMBSTONE)
+		index = (index + 1) & mask;
+
+	if (entries_[index] == TOMBSTONE)
+		tombstones_--;
+	else
+		count_++;
+	entries_[index] = str;
+}
+
+void StringTable::remove(ObjString *str) noexcept
+{
+	if (count_ == 0)
+		return;
+	size_t mask = capacity_ - 1;
+	for (size_t index = str->hash_ & mask; entries_[index] != nullptr; index = (index + 1) & mask)
+	{
+		if (entries_[index] == str)
+		{
+			entries_[index] = TOMBSTONE;
+			tombstones_++;
+			return;
+		}
+	}
+}
+
+void StringTable::remove_white() noexcept
+{
+	for (size_t i = 0; i < capacity_; i++)
+	{
+		auto entry = entries_[i];
+		if (entry != nullptr && entry != TOMBSTONE && !entry->is_marked_)
+		{
+			entries_[i] = TOMBSTONE;
+			tombstones_++;
+		}
+	}
+}
+
+void StringTable::adjust_capacity(size_t capacity)
+{
+	auto entries = Allocator<ObjString *>().allocate(capacity);
+	std::fill_n(entries, capacity, nullptr);
+
+	auto old_entries = entries_;
+	auto old_capacity = capacity_;
+	entries_ = entries;
+	capacity_ = capacity;
+	count_ = tombstones_ = 0;
+
+	for (size_t i = 0; i < old_capacity; i++)
+	{
+		auto entry = old_entries[i];
+		if (entry != nullptr && entry != TOMBSTONE)
+			insert(entry);
+	}
+	if (old_entries != nullptr)
+		Allocator<ObjString *>().deallocate(old_entries, old_capacity);
+}
@@ -40,11 +40,6 @@ Value Value::operator-() const
 		throw std::runtime_error("Operator need to be a number.");
 }
 
-Value::Value(bool value) : value_(value) {}
-Value::Value() : value_(std::monostate()) {}
-Value::Value(int value) : value_(value) {}
-Value::Value(Obj *obj) : value_(obj) {}
-
 template auto Value::is_obj_type<ObjString>() const -> typename std::enable_if_t<std::is_base_of_v<Obj, ObjString> && !std::is_same_v<Obj, ObjString>, bool>;
 template auto Value::as_obj<ObjString>() const -> typename std::enable_if_t<std::is_base_of_v<Obj, ObjString> && !std::is_same_v<Obj, ObjString>, ObjString *>;
 template auto Value::is_obj_type<ObjFunction>() const -> typename std::enable_if_t<std::is_base_of_v<Obj, ObjFunction> && !std::is_same_v<Obj, ObjFunction>, bool>;
@@ -91,6 +86,16 @@ auto Value::as_obj() const -> typename std::enable_if_t<std::is_base_of_v<Obj, U
 
 std::ostream &operator<<(std::ostream &os, const Value &value)
 {
+#ifdef NAN_BOXING
+	if (value.is_bool())
+		os << std::boolalpha << value.as<bool>() << std::noboolalpha;
+	else if (value.is_nil())
+		os << "nil";
+	else if (value.is_number())
+		os << value.as<int>();
+	else
+		os << *value.as<Obj *>();
+#else
 	std::visit([&os](auto &&arg)
 			   {
                    using T = std::decay_t<decltype(arg)>;
@@ -104,6 +109,7 @@ std::ostream &operator<<(std::ostream &os, const Value &value)
                        os << *arg;
                    } },
 			   value.value_);
+#endif
 
 	return os;
-}
+}
\ No newline at end of file
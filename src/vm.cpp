@@ -13,6 +13,7 @@
     {                                                     \
         if (!peek(0).is_number() || !peek(1).is_number()) \
         {                                                 \
+            SAVE_FRAME();                                 \
             runtime_error("Operands must be numbers.");   \
             return INTERPRET_RUNTIME_ERROR;               \
         }                                                 \
@@ -21,18 +22,205 @@
         push(a op b);                                     \
     } while (false);
 
-VM::VM() : cu_(*this), globals_(), gc_(*this), scheduler_(*this)
+// compare-and-branch: local `op` a local or constant, jumping when the result is jump_when
+#define COMPARE_JUMP(op, jump_when, right)                \
+    do                                                    \
+    {                                                     \
+        const Value &a = frame->slots_[READ_BYTE()];      \
+        const Value &b = right;                           \
+        int offset = READ_SHORT();                        \
+        if (!a.is_number() || !b.is_number())             \
+        {                                                 \
+            SAVE_FRAME();                                 \
+            runtime_error("Operands must be numbers.");   \
+            return INTERPRET_RUNTIME_ERROR;               \
+        }                                                 \
+        if ((a.as<int>() op b.as<int>()) == jump_when)    \
+            ip += offset;                                 \
+    } while (false);
+#define EQUAL_JUMP(jump_when, right)                      \
+    do                                                    \
+    {                                                     \
+        const Value &a = frame->slots_[READ_BYTE()];      \
+        const Value &b = right;                           \
+        int offset = READ_SHORT();                        \
+        if ((a == b) == jump_when)                        \
+            ip += offset;                                 \
+    } while (false);
+
+// register backend: write value to slot of the frame, pushing it when the slot is one past the top
+// of the stack; the value is computed first, as pushing may move the stack
+#define STORE_REGISTER(slot, value)                                                         \
+    do                                                                                      \
+    {                                                                                       \
+        Value stored = (value);                                                             \
+        Value *target = frame->slots_ + (slot);                                             \
+        if (target == current_coroutine_->stack_.data() + current_coroutine_->top_)         \
+            push(stored);                                                                   \
+        else                                                                                \
+            *target = stored;                                                               \
+    } while (false)
+// slot A = slot B `op` right, for the OP_*_REG_REG/OP_*_REG_CONST on numbers
+#define REGISTER_OP(op, right)                            \
+    do                                                    \
+    {                                                     \
+        uint8_t slot = READ_BYTE();                       \
+        const Value &a = frame->slots_[READ_BYTE()];      \
+        const Value &b = right;                           \
+        if (!a.is_number() || !b.is_number())             \
+        {                                                 \
+            SAVE_FRAME();                                 \
+            runtime_error("Operands must be numbers.");   \
+            return INTERPRET_RUNTIME_ERROR;               \
+        }                                                 \
+        STORE_REGISTER(slot, Value(a.as<int>() op b.as<int>())); \
+    } while (false);
+#define REGISTER_ADD(right)                                                             \
+    do                                                                                  \
+    {                                                                                   \
+        uint8_t slot = READ_BYTE();                                                     \
+        const Value &a = frame->slots_[READ_BYTE()];                                    \
+        const Value &b = right;                                                         \
+        if (a.is_number() && b.is_number())                                             \
+        {                                                                               \
+            STORE_REGISTER(slot, Value(a.as<int>() + b.as<int>()));                     \
+            break;                                                                      \
+        }                                                                               \
+        Value text;                                                                     \
+        if (!concatenate(a, b, text))                                                   \
+        {                                                                               \
+            SAVE_FRAME();                                                               \
+            runtime_error("Operands must be two numbers or (string + anything).");      \
+            return INTERPRET_RUNTIME_ERROR;                                             \
+        }                                                                               \
+        STORE_REGISTER(slot, text);                                                     \
+        SAFEPOINT();                                                                    \
+    } while (false);
+#define REGISTER_EQUAL(right)                             \
+    do                                                    \
+    {                                                     \
+        uint8_t slot = READ_BYTE();                       \
+        const Value &a = frame->slots_[READ_BYTE()];      \
+        const Value &b = right;                           \
+        STORE_REGISTER(slot, Value(a == b));              \
+    } while (false);
+
+#if defined(COMPUTED_GOTO) && defined(__GNUC__)
+#define USE_COMPUTED_GOTO // labels-as-values is a GCC/Clang extension, other compilers keep the switch
+#endif
+
+#define READ_BYTE() (*ip++)
+#define READ_SHORT() (ip += 2, static_cast<uint16_t>((ip[-2] << 8) | ip[-1]))
+#define READ_CONSTANT() (frame->constants_[READ_BYTE()])
+#define READ_STRING() (READ_CONSTANT().as_obj<ObjString>())
+
+// ip lives in a local inside VM::run; write it back before anything that
+// reads frames_ (calls, runtime errors, coroutine switches) and reload after
+#define SAVE_FRAME() (frame->ip_ = ip)
+#define LOAD_FRAME()                                                                \
+    do                                                                              \
+    {                                                                               \
+        frame = &current_coroutine_->frames_[current_coroutine_->frame_count_ - 1]; \
+        ip = frame->ip_;                                                            \
+    } while (false)
+
+#ifdef DEBUG_MODE
+#define TRACE_INSTRUCTION()                                                                 \
+    do                                                                                      \
+    {                                                                                       \
+        if (!gc_.trace_)                                                                    \
+            break;                                                                          \
+        printf("           stackframe: ");                                                  \
+        for (int i = 0; i < current_coroutine_->top_; i++)                                  \
+            std::cout << "[ " << current_coroutine_->stack_.at(i) << " ]";                  \
+        std::cout << "\n";                                                                  \
+        Util::disassemble_instruction(frame->closure_->function_->chunk_,                   \
+                                      ip - frame->closure_->function_->chunk_.bytecode_.data()); \
+    } while (false)
+#else
+#define TRACE_INSTRUCTION() \
+    do                      \
+    {                       \
+    } while (false)
+#endif
+
+#ifdef PROFILE_OPCODES
+#define PROFILE_INSTRUCTION() profile_.record(frame->closure_->function_->chunk_, ip)
+#else
+#define PROFILE_INSTRUCTION() \
+    do                        \
+    {                         \
+    } while (false)
+#endif
+
+#ifdef USE_COMPUTED_GOTO
+#define CASE(name) do_##name:
+#define DISPATCH()                            \
+    do                                        \
+    {                                         \
+        TRACE_INSTRUCTION();                  \
+        PROFILE_INSTRUCTION();                \
+        instruction = READ_BYTE();            \
+        goto *dispatch_table[instruction];    \
+    } while (false)
+// run the handler of op for the instruction whose opcode was just read
+#define REDISPATCH(op)                        \
+    do                                        \
+    {                                         \
+        instruction = op;                     \
+        goto *dispatch_table[instruction];    \
+    } while (false)
+#else
+#define CASE(name) case name:
+#define DISPATCH() break
+#define REDISPATCH(op)                        \
+    do                                        \
+    {                                         \
+        instruction = op;                     \
+        goto dispatch_instruction;            \
+    } while (false)
+#endif
+
+#if defined(QUICKEN_BYTECODE) && !defined(PROFILE_OPCODES)
+// rewrite the opcode just read to op in place; a handler entered through REDISPATCH finds the
+// superinstruction it came from there instead and leaves it alone. Profiling builds never quicken:
+// superinstructions are made of the generic opcodes
+#define QUICKEN(op)                             \
+    do                                          \
+    {                                           \
+        if (ip[-1] == instruction)              \
+            const_cast<uint8_t *>(ip)[-1] = op; \
+    } while (false)
+#else
+#define QUICKEN(op) \
+    do              \
+    {               \
+    } while (false)
+#endif
+// an operand no longer has the type a quickened opcode was specialized for: go back to the generic one
+#define DEQUICKEN(op)  \
+    do                 \
+    {                  \
+        QUICKEN(op);   \
+        REDISPATCH(op); \
+    } while (false)
+
+// the only place a collection runs: after an instruction that allocates, calls or loops back,
+// when every value it still needs is on the stack
+#define SAFEPOINT() gc_.safepoint()
+
+VM::VM(SchedulePolicy policy) : cu_(*this), globals_(), gc_(*this), scheduler_(*this, policy)
 {
-    AllocBase::init(&gc_);
     init_string_ = create_obj_string(std::string_view("init"), *this);
-    ObjCoroutine tmpCo; // when define_native we dont have a co so just make it for not be gc
-    current_coroutine_ = &tmpCo;
     define_native("clock", Native::clock);
     define_native("insert", Native::insert);
     define_native("erase", Native::erase);
     define_native("push", Native::push);
     define_native("pop", Native::pop);
-    current_coroutine_ = nullptr;
+    define_native("gcStats", Native::gcStats);
+    define_native("spawn", Native::spawn);
+    define_native("submit", Native::submit);
+    define_native("join", Native::join);
 }
 
 bool VM::call_value(const Value &callee, uint8_t argCount)
@@ -54,9 +242,8 @@ bool VM::call_value(const Value &callee, uint8_t argCount)
             current_coroutine_->stack_.at(current_coroutine_->top_ - 1 - argCount) = create_obj<ObjInstance>(gc_, klass); // Objinstance 覆盖掉 Objclass
             // 覆盖掉 <class a>
             Value initializer;
-            if (klass->methods_.find(init_string_) != klass->methods_.end())
+            if (klass->methods_.get(init_string_, initializer))
             {
-                initializer = klass->methods_.at(init_string_);
                 return call(initializer.as_obj<ObjClosure>(), argCount);
             }
             else if (argCount != 0)
@@ -98,15 +285,15 @@ bool VM::call(ObjClosure *closure, int argCount)
         runtime_error("Stack overflow.");
         return false;
     }
+    if (static_cast<size_t>(current_coroutine_->frame_count_) == current_coroutine_->frames_.size())
+        current_coroutine_->grow_frames();
     CallFrame &frame = current_coroutine_->frames_[current_coroutine_->frame_count_++];
-    frame.closure_ = closure;
-    frame.ip_ = 0;
-    frame.slot_ = current_coroutine_->top_ - argCount - 1; // 指向可调用obj的位置（省的pop，直接覆盖掉）
-                                                           // 期望返回值放在此处
+    frame.init(closure, current_coroutine_->stack_.data() + current_coroutine_->top_ - argCount - 1); // 指向可调用obj的位置（省的pop，直接覆盖掉）
+                                                                                                      // 期望返回值放在此处
     return true;
 }
 
-bool VM::invoke(ObjString *name, int argCount)
+bool VM::invoke(ObjString *name, int argCount, InvokeCache &cache)
 {
     Value receiver = peek(argCount);
     if (!receiver.is_obj_type<ObjInstance>())
@@ -115,33 +302,37 @@ bool VM::invoke(ObjString *name, int argCount)
         return false;
     }
     ObjInstance *instance = receiver.as_obj<ObjInstance>();
+    if (auto method = cache.find(instance->shape_->id_, instance->objClass_->stamp_))
+        return call(method, argCount);
 
-    if (instance->fields_.find(name) != instance->fields_.end())
+    if (int slot = instance->shape_->find(name); slot >= 0)
     {
-        Value value = instance->fields_.at(name);
+        Value value = instance->fields_[slot];
         current_coroutine_->stack_[current_coroutine_->top_ - argCount - 1] = value;
         return call_value(value, argCount);
     }
 
-    return invoke_from_class(instance->objClass_, name, argCount);
+    return invoke_from_class(instance->objClass_, name, argCount, cache, instance->shape_->id_);
 }
 
 bool VM::invoke_from_class(ObjClass *klass, ObjString *name,
-                           int argCount)
+                           int argCount, InvokeCache &cache, uint32_t shape_id)
 {
-    if (klass->methods_.find(name) == klass->methods_.end())
+    Value method;
+    if (!klass->methods_.get(name, method))
     {
         runtime_error("Undefined property ", name, ".");
         return false;
     }
-    auto method = klass->methods_.at(name);
-    return call(method.as_obj<ObjClosure>(), argCount);
+    auto closure = method.as_obj<ObjClosure>();
+    cache.insert(shape_id, klass->stamp_, closure);
+    return call(closure, argCount);
 }
 
 ObjUpvalue *VM::capture_upvalue(Value *local)
 {
     ObjUpvalue *prevUpvalue = NULL;
-    ObjUpvalue *upvalue = open_upvalues_;
+    ObjUpvalue *upvalue = current_coroutine_->open_upvalues_;
     while (upvalue != nullptr && upvalue->location_ > local)
     {
         prevUpvalue = upvalue;
@@ -155,23 +346,30 @@ ObjUpvalue *VM::capture_upvalue(Value *local)
     createdUpvalue->next_ = upvalue;
 
     if (prevUpvalue == NULL)
-        open_upvalues_ = createdUpvalue;
+        current_coroutine_->open_upvalues_ = createdUpvalue;
     else
         prevUpvalue->next_ = createdUpvalue;
+    gc_.write_barrier(current_coroutine_, createdUpvalue);
 
     return createdUpvalue;
 }
 
 void VM::define_native(std::string_view name, NativeFn function)
 {
-    if (current_coroutine_ != nullptr)
-    {
-        push(create_obj_string(name, *this));
-        push(create_obj<ObjNative>(gc_, function, name));
-        globals_.insert_or_assign(current_coroutine_->stack_.at(0).as_obj<ObjString>(), current_coroutine_->stack_.at(1));
-        pop();
-        pop();
-    }
+    auto slot = global_slot(create_obj_string(name, *this));
+    global_values_[slot] = create_obj<ObjNative>(gc_, function, name);
+}
+
+uint16_t VM::global_slot(ObjString *name)
+{
+    Value slot;
+    if (globals_.get(name, slot))
+        return slot.as<int>();
+    auto index = static_cast<uint16_t>(global_values_.size());
+    global_values_.push_back(Value::undefined());
+    global_names_.push_back(name);
+    globals_.set(name, static_cast<int>(index));
+    return index;
 }
 
 InterpretResult VM::interpret(const std::string &source)
@@ -184,16 +382,12 @@ InterpretResult VM::interpret(const std::string &source)
     ObjCoroutine *co = create_obj<ObjCoroutine>(gc_, closure); // modify
     // in memory.cpp current_coroutine is nullptr to gc
 
-    // scheduler_.addObjCoroutine(co);
-    scheduler_.main_coroutine = co;
     co->is_main_ = true;
     co->stack_[0] = co->closure_;
     co->top_ = 1;
     co->frame_count_ = 1;
-    co->frames_[0].closure_ = closure;
-    co->frames_[0].ip_ = 0;
-    co->frames_[0].slot_ = 0;
-    return scheduler_.resumeCoroutine(co);
+    co->frames_[0].init(closure, co->stack_.data());
+    return scheduler_.start(co);
 }
 
 bool is_falsey(const Value &value)
@@ -202,78 +396,116 @@ bool is_falsey(const Value &value)
            (value.is_bool() && !value.as<bool>());
 }
 
+#ifdef USE_COMPUTED_GOTO
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
 InterpretResult VM::run(ObjCoroutine *co)
 {
     current_coroutine_ = co; // vm just hold a ptr to target co
 
-    CallFrame *frame = &current_coroutine_->frames_[current_coroutine_->frame_count_ - 1];
+    CallFrame *frame;
+    const uint8_t *ip;
+    uint8_t instruction;
+    LOAD_FRAME();
 
-    while (co->status_ != CoroutineStatus::FINISHED)
+#ifdef USE_COMPUTED_GOTO
+    static void *dispatch_table[] = {
+#define X(name) &&do_##name,
+        OPCODE_NAMES
+#undef X
+    };
+    DISPATCH();
+#else
+    for (;;)
     {
-#ifdef DEBUG_MODE
-        printf("           stackframe: ");
-        for (int i = 0; i < current_coroutine_->top_; i++)
-            std::cout << "[ " << current_coroutine_->stack_.at(i) << " ]";
-        std::cout << "\n";
-        Util::disassemble_instruction(frame->closure_->function_->chunk_, frame->ip_);
-#endif
-        uint8_t instruction = frame->read_byte();
+        TRACE_INSTRUCTION();
+        PROFILE_INSTRUCTION();
+        instruction = READ_BYTE();
+    dispatch_instruction:
         switch (instruction)
+#endif
         {
-        case OP_RETURN:
+        CASE(OP_RETURN)
         {
             Value result = pop(); // 先弹后压 result 是为了清理当前栈范围内的槽，后面退到上一个栈时再压入作为返回值
-            close_upvalues(current_coroutine_->stack_.data() + frame->slot_);
+            close_upvalues(frame->slots_);
             current_coroutine_->frame_count_--; // leave current frame
             if (current_coroutine_->frame_count_ == 0)
             {
-                co->status_ = CoroutineStatus::FINISHED;
-                if (co->is_main_ == true)
+                if (current_coroutine_->is_main_)
+                    result_ = result;
+                if (!scheduler_.finishCurrentObjCoroutine())
                     return INTERPRET_OK;
-                else
-                    return scheduler_.runNextObjCoroutine();
+                LOAD_FRAME();
+                DISPATCH();
             }
-            current_coroutine_->top_ = frame->slot_; // 回退到上一个栈顶，对于call之前的栈顶通常指着closure或者instance本身
+            current_coroutine_->top_ = frame->slots_ - current_coroutine_->stack_.data(); // 回退到上一个栈顶，对于call之前的栈顶通常指着closure或者instance本身
             push(result);
-            frame = &current_coroutine_->frames_[current_coroutine_->frame_count_ - 1];
-            break;
+            LOAD_FRAME();
+            DISPATCH();
         }
-        case OP_CONSTANT:
+        CASE(OP_CONSTANT)
         {
-            push(frame->read_constant());
-            break;
+            push(READ_CONSTANT());
+            DISPATCH();
         }
-        case OP_TRUE:
+        CASE(OP_TRUE)
         {
             push(Value(true));
-            break;
+            DISPATCH();
         }
-        case OP_FALSE:
+        CASE(OP_FALSE)
         {
             push(Value(false));
-            break;
+            DISPATCH();
         }
-        case OP_NIL:
+        CASE(OP_NIL)
         {
             push(Value());
-            break;
+            DISPATCH();
         }
-        case OP_EQUAL:
+        CASE(OP_EQUAL)
         {
             auto b = pop();
             auto a = pop();
             push(a == b);
-            break;
+            DISPATCH();
         }
-        case OP_GREATER:
+        CASE(OP_GREATER)
         {
             BINARY_OP(>);
-            break;
+            DISPATCH();
         }
-        case OP_LESS:
+        CASE(OP_LESS)
+            if (peek(0).is_number() && peek(1).is_number())
+                QUICKEN(OP_LESS_INT);
             BINARY_OP(<);
-            break;
-        case OP_ADD:
+            DISPATCH();
+        CASE(OP_LESS_INT)
+        {
+            Value &a = current_coroutine_->stack_[current_coroutine_->top_ - 2];
+            const Value &b = current_coroutine_->stack_[current_coroutine_->top_ - 1];
+            if (!a.is_number() || !b.is_number())
+                DEQUICKEN(OP_LESS);
+            a = a.as<int>() < b.as<int>();
+            current_coroutine_->top_--;
+            DISPATCH();
+        }
+        CASE(OP_NOT_EQUAL)
+        {
+            auto b = pop();
+            auto a = pop();
+            push(!(a == b));
+            DISPATCH();
+        }
+        CASE(OP_LESS_EQUAL)
+            BINARY_OP(<=);
+            DISPATCH();
+        CASE(OP_GREATER_EQUAL)
+            BINARY_OP(>=);
+            DISPATCH();
+        CASE(OP_ADD)
         {
             // 取出栈顶和次顶操作数（注意：peek(0) 是栈顶）
             Value rightVal = peek(0);
@@ -282,6 +514,7 @@ InterpretResult VM::run(ObjCoroutine *co)
             // 如果两个都是数值，则执行数值相加
             if (leftVal.is_number() && rightVal.is_number())
             {
+                QUICKEN(OP_ADD_INT);
                 // 为了示例，这里假设存的都是 int
                 int b = pop().as<int>(); // right
                 int a = pop().as<int>(); // left
@@ -290,294 +523,515 @@ InterpretResult VM::run(ObjCoroutine *co)
             // 否则，如果两个都是字符串，或者至少有一个是字符串，就进行字符串拼接
             else
             {
+                if (leftVal.is_obj() && leftVal.as<Obj *>()->is_type(objtype_of<ObjString>()) &&
+                    rightVal.is_obj() && rightVal.as<Obj *>()->is_type(objtype_of<ObjString>()))
+                    QUICKEN(OP_ADD_STR);
                 pop(); // rightVal
                 pop(); // leftVal
-                try
-                {
-                    auto leftStr = Value::value_to_string(leftVal);
-                    auto rightStr = Value::value_to_string(rightVal);
-                    ObjString *res = create_obj_string(leftStr + rightStr, *this);
-                    push(Value(res));
-                }
-                catch (...)
+                Value res;
+                if (!concatenate(leftVal, rightVal, res))
                 {
+                    SAVE_FRAME();
                     runtime_error("Operands must be two numbers or (string + anything).");
                     return INTERPRET_RUNTIME_ERROR;
                 }
+                push(res);
+                SAFEPOINT();
             }
-            break;
+            DISPATCH();
+        }
+        CASE(OP_ADD_INT)
+        {
+            Value &a = current_coroutine_->stack_[current_coroutine_->top_ - 2];
+            const Value &b = current_coroutine_->stack_[current_coroutine_->top_ - 1];
+            if (!a.is_number() || !b.is_number())
+                DEQUICKEN(OP_ADD);
+            a = a.as<int>() + b.as<int>();
+            current_coroutine_->top_--;
+            DISPATCH();
+        }
+        CASE(OP_ADD_STR)
+        {
+            const Value &a = peek(1);
+            const Value &b = peek(0);
+            if (!a.is_obj() || !a.as<Obj *>()->is_type(objtype_of<ObjString>()) ||
+                !b.is_obj() || !b.as<Obj *>()->is_type(objtype_of<ObjString>()))
+                DEQUICKEN(OP_ADD);
+            ObjString *res;
+            { // DISPATCH jumps out through a computed goto, which skips destructors
+                auto left = static_cast<ObjString *>(a.as<Obj *>())->text();
+                auto right = static_cast<ObjString *>(b.as<Obj *>())->text();
+                std::string text;
+                text.reserve(left.size() + right.size());
+                text.append(left).append(right);
+                res = create_obj_string(std::move(text), *this);
+            }
+            current_coroutine_->top_ -= 2;
+            push(Value(res));
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_SUB:
+        CASE(OP_SUB)
         {
             BINARY_OP(-);
-            break;
+            DISPATCH();
         }
-        case OP_MUL:
+        CASE(OP_MUL)
         {
             BINARY_OP(*);
-            break;
+            DISPATCH();
         }
-        case OP_DIV:
+        CASE(OP_DIV)
         {
             BINARY_OP(/);
-            break;
+            DISPATCH();
         }
-        case OP_NOT:
+        CASE(OP_NOT)
         {
             push(is_falsey(pop()));
-            break;
+            DISPATCH();
         }
-        case OP_NEGATE:
+        CASE(OP_NEGATE)
         {
             if (!peek(0).is_number())
             {
+                SAVE_FRAME();
                 runtime_error("Operand must be a number.");
                 return INTERPRET_RUNTIME_ERROR;
             }
             push(-pop().as<int>());
-            break;
+            DISPATCH();
         }
-        case OP_PRINT:
+        CASE(OP_PRINT)
         {
             std::cout << pop() << std::endl;
-            break;
+            DISPATCH();
         }
-        case OP_DEFINE_GLOBAL:
+        CASE(OP_DEFINE_GLOBAL)
         {
-            auto name = frame->read_string();
-            globals_.insert_or_assign(name, peek(0));
+            global_values_[READ_SHORT()] = peek(0);
             pop();
-            break;
+            DISPATCH();
         }
-        case OP_GET_GLOBAL:
+        CASE(OP_GET_GLOBAL)
         {
-            auto name = frame->read_string();
-            try
-            {
-                auto &value = globals_.at(name);
-                push(value);
-            }
-            catch (const std::out_of_range &)
+            auto slot = READ_SHORT();
+            const Value &value = global_values_[slot];
+            if (value.is_undefined())
             {
-                runtime_error("Undefined variable ", name->text());
+                SAVE_FRAME();
+                runtime_error("Undefined variable ", global_names_[slot]->text());
                 return INTERPRET_RUNTIME_ERROR;
             }
-            break;
+            push(value);
+            DISPATCH();
         }
-        case OP_SET_GLOBAL:
+        CASE(OP_SET_GLOBAL)
         {
-            auto name = frame->read_string();
-            globals_.insert_or_assign(name, peek(0)); // modify ?
-            break;
+            global_values_[READ_SHORT()] = peek(0); // modify ?
+            DISPATCH();
         }
-        case OP_POP:
+        CASE(OP_POP)
         {
             pop();
-            break;
+            DISPATCH();
         }
-        case OP_GET_LOCAL:
+        CASE(OP_POPN)
         {
-            int slot = frame->read_byte();
-            push(current_coroutine_->stack_[frame->slot_ + slot]);
-            break;
+            current_coroutine_->top_ -= READ_BYTE();
+            DISPATCH();
         }
-        case OP_SET_LOCAL:
+        CASE(OP_GET_LOCAL)
         {
-            int slot = frame->read_byte();
-            current_coroutine_->stack_[frame->slot_ + slot] = peek(0);
-            break;
+            int slot = READ_BYTE();
+            push(frame->slots_[slot]);
+            DISPATCH();
         }
-        case OP_JUMP_IF_FALSE:
+        CASE(OP_SET_LOCAL)
         {
-            int offset = frame->read_short();
+            int slot = READ_BYTE();
+            frame->slots_[slot] = peek(0);
+            DISPATCH();
+        }
+        CASE(OP_JUMP_IF_FALSE)
+        {
+            int offset = READ_SHORT();
             if (is_falsey(peek(0)))
-                frame->ip_ += offset;
-            break;
+                ip += offset;
+            DISPATCH();
         }
-        case OP_JUMP:
+        CASE(OP_JUMP)
         {
-            int offset = frame->read_short();
-            frame->ip_ += offset;
-            break;
+            int offset = READ_SHORT();
+            ip += offset;
+            DISPATCH();
         }
-        case OP_LOOP:
+        CASE(OP_JUMP_IF_NOT_EQUAL_LOCAL_LOCAL)
+            EQUAL_JUMP(false, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_JUMP_IF_NOT_LESS_LOCAL_LOCAL)
+            COMPARE_JUMP(<, false, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_JUMP_IF_NOT_GREATER_LOCAL_LOCAL)
+            COMPARE_JUMP(>, false, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_JUMP_IF_EQUAL_LOCAL_LOCAL)
+            EQUAL_JUMP(true, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_JUMP_IF_LESS_LOCAL_LOCAL)
+            COMPARE_JUMP(<, true, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_JUMP_IF_GREATER_LOCAL_LOCAL)
+            COMPARE_JUMP(>, true, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_JUMP_IF_NOT_EQUAL_LOCAL_CONST)
+            EQUAL_JUMP(false, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_JUMP_IF_NOT_LESS_LOCAL_CONST)
+            COMPARE_JUMP(<, false, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_JUMP_IF_NOT_GREATER_LOCAL_CONST)
+            COMPARE_JUMP(>, false, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_JUMP_IF_EQUAL_LOCAL_CONST)
+            EQUAL_JUMP(true, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_JUMP_IF_LESS_LOCAL_CONST)
+            COMPARE_JUMP(<, true, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_JUMP_IF_GREATER_LOCAL_CONST)
+            COMPARE_JUMP(>, true, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_ADD_REG_REG)
+            REGISTER_ADD(frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_SUB_REG_REG)
+            REGISTER_OP(-, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_MUL_REG_REG)
+            REGISTER_OP(*, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_DIV_REG_REG)
+            REGISTER_OP(/, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_EQUAL_REG_REG)
+            REGISTER_EQUAL(frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_LESS_REG_REG)
+            REGISTER_OP(<, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_GREATER_REG_REG)
+            REGISTER_OP(>, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        CASE(OP_ADD_REG_CONST)
+            REGISTER_ADD(READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_SUB_REG_CONST)
+            REGISTER_OP(-, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_MUL_REG_CONST)
+            REGISTER_OP(*, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_DIV_REG_CONST)
+            REGISTER_OP(/, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_EQUAL_REG_CONST)
+            REGISTER_EQUAL(READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_LESS_REG_CONST)
+            REGISTER_OP(<, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_GREATER_REG_CONST)
+            REGISTER_OP(>, READ_CONSTANT());
+            DISPATCH();
+        CASE(OP_NEGATE_REG)
         {
-            int offset = frame->read_short();
-            frame->ip_ -= offset;
-            break;
+            uint8_t slot = READ_BYTE();
+            const Value &a = frame->slots_[READ_BYTE()];
+            if (!a.is_number())
+            {
+                SAVE_FRAME();
+                runtime_error("Operand must be a number.");
+                return INTERPRET_RUNTIME_ERROR;
+            }
+            STORE_REGISTER(slot, Value(-a.as<int>()));
+            DISPATCH();
         }
-        case OP_CONTINUE:
-        case OP_BREAK:
+        CASE(OP_NOT_REG)
         {
-            int is_break = (instruction == OP_BREAK);
-            int offset = frame->read_short();
-            frame->ip_ = offset + is_break;
-            break;
+            uint8_t slot = READ_BYTE();
+            STORE_REGISTER(slot, Value(is_falsey(frame->slots_[READ_BYTE()])));
+            DISPATCH();
+        }
+        CASE(OP_MOVE_REG)
+        {
+            uint8_t slot = READ_BYTE();
+            STORE_REGISTER(slot, frame->slots_[READ_BYTE()]);
+            DISPATCH();
+        }
+        CASE(OP_LOAD_CONST)
+        {
+            uint8_t slot = READ_BYTE();
+            STORE_REGISTER(slot, READ_CONSTANT());
+            DISPATCH();
         }
-        case OP_CALL:
+        CASE(OP_LOOP)
         {
-            int argCount = frame->read_byte();
+            int offset = READ_SHORT();
+            ip -= offset;
+            SAFEPOINT();
+            DISPATCH();
+        }
+        CASE(OP_CONTINUE)
+        CASE(OP_BREAK)
+        {
+            int offset = READ_SHORT();
+            ip = frame->closure_->function_->chunk_.bytecode_.data() + offset;
+            SAFEPOINT(); // continue loops back without OP_LOOP
+            DISPATCH();
+        }
+        CASE(OP_CALL)
+        {
+            int argCount = READ_BYTE();
+            SAVE_FRAME();
             if (!call_value(peek(argCount), argCount))
                 return INTERPRET_RUNTIME_ERROR;
-            frame = &current_coroutine_->frames_[current_coroutine_->frame_count_ - 1]; // frame update, leave function scope
-            break;
+            LOAD_FRAME(); // frame update, leave function scope
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_FUNCTION:
+        CASE(OP_FUNCTION)
         {
-            auto function = frame->read_constant().as_obj<ObjFunction>();
+            auto function = READ_CONSTANT().as_obj<ObjFunction>();
             push(function);
-            break;
+            DISPATCH();
         }
-        case OP_CLOSURE:
+        CASE(OP_CLOSURE)
         {
-            auto function = frame->read_constant().as_obj<ObjFunction>();
+            auto function = READ_CONSTANT().as_obj<ObjFunction>();
             auto closure = create_obj<ObjClosure>(gc_, function);
             push(closure);
             for (int i = 0; i < closure->upvalue_count(); i++)
             {
-                auto is_local = frame->read_byte();
-                auto index = frame->read_byte();
+                auto is_local = READ_BYTE();
+                auto index = READ_BYTE();
                 if (is_local)
-                    closure->upvalues_.at(i) = capture_upvalue(current_coroutine_->stack_.data() + frame->slot_ + index);
+                    closure->upvalues_.at(i) = capture_upvalue(frame->slots_ + index); // may promote closure
                 else
                     closure->upvalues_.at(i) = frame->closure_->upvalues_.at(index);
+                gc_.write_barrier(closure, closure->upvalues_.at(i));
             }
-            break;
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_CLOSE_UPVALUE:
+        CASE(OP_CLOSE_UPVALUE)
         {
             close_upvalues(current_coroutine_->stack_.data() + current_coroutine_->top_ - 1);
             pop();
-            break;
+            DISPATCH();
         }
-        case OP_GET_UPVALUE:
+        CASE(OP_GET_UPVALUE)
         {
-            uint8_t slot = frame->read_byte();
+            uint8_t slot = READ_BYTE();
             push(*frame->closure_->upvalues_[slot]->location_);
-            break;
+            DISPATCH();
         }
-        case OP_SET_UPVALUE:
+        CASE(OP_SET_UPVALUE)
         {
-            uint8_t slot = frame->read_byte();
-            *frame->closure_->upvalues_[slot]->location_ = peek(0);
-            break;
+            uint8_t slot = READ_BYTE();
+            auto upvalue = frame->closure_->upvalues_[slot];
+            *upvalue->location_ = peek(0);
+            gc_.write_barrier(upvalue, peek(0)); // only matters once the upvalue is closed
+            DISPATCH();
         }
-        case OP_CLASS:
+        CASE(OP_CLASS)
         {
-            push(create_obj<ObjClass>(gc_, frame->read_string()));
-            break;
+            push(create_obj<ObjClass>(gc_, READ_STRING()));
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_GET_PROPERTY:
+        CASE(OP_GET_PROPERTY)
         {
+            auto name = READ_STRING();
+            auto &cache = frame->caches_[READ_SHORT()];
             if (!peek(0).is_obj_type<ObjInstance>())
             {
+                SAVE_FRAME();
                 runtime_error("Only instances have properties.");
                 return INTERPRET_RUNTIME_ERROR;
             }
 
             auto instance = peek(0).as_obj<ObjInstance>();
-            auto name = frame->read_string();
-            try
+            int slot = cache.slot_;
+            if (instance->shape_->id_ != cache.shape_id_)
+            {
+                slot = instance->shape_->find(name);
+                if (slot >= 0)
+                    cache = {instance->shape_->id_, static_cast<uint32_t>(slot), nullptr};
+            }
+            if (slot >= 0)
             {
-                auto &value = instance->fields_.at(name);
+                Value value = instance->fields_[slot];
                 pop();
                 push(value);
             }
-            catch (const std::out_of_range &)
+            else
             {
+                SAVE_FRAME();
                 if (!bind_method(instance->objClass_, name)) // 找不到instance's fileds那么找klass中的methods
                     return INTERPRET_RUNTIME_ERROR;
             }
-            break;
+            DISPATCH();
         }
-        case OP_SET_PROPERTY:
+        CASE(OP_SET_PROPERTY)
         {
+            auto name = READ_STRING();
+            auto &cache = frame->caches_[READ_SHORT()];
+            if (!peek(1).is_obj_type<ObjInstance>())
+            {
+                SAVE_FRAME();
+                runtime_error("Only instances have fields.");
+                return INTERPRET_RUNTIME_ERROR;
+            }
+
             auto instance = peek(1).as_obj<ObjInstance>();
-            instance->fields_.insert_or_assign(frame->read_string(), peek(0));
+            if (instance->shape_->id_ != cache.shape_id_)
+            {
+                auto shape = instance->shape_;
+                int slot = shape->find(name);
+                if (slot >= 0)
+                    cache = {shape->id_, static_cast<uint32_t>(slot), nullptr};
+                else
+                {
+                    cache = {shape->id_, static_cast<uint32_t>(shape->field_count()), shape->transition(name)};
+                    gc_.write_barrier(instance->objClass_, name); // the class owns the new shape's names
+                }
+            }
+            if (cache.next_shape_ == nullptr)
+                instance->fields_[cache.slot_] = peek(0);
+            else
+            {
+                instance->fields_.push_back(peek(0));
+                instance->shape_ = cache.next_shape_;
+            }
+            gc_.write_barrier(instance, peek(0));
             Value value = pop();
             pop();
             push(value);
-            break;
+            DISPATCH();
         }
-        case OP_METHOD:
+        CASE(OP_METHOD)
         {
-            define_method(frame->read_string());
-            break;
+            define_method(READ_STRING());
+            DISPATCH();
         }
-        case OP_INVOKE:
+        CASE(OP_INVOKE)
         {
-            ObjString *method = frame->read_string();
-            int argCount = frame->read_byte();
-            if (!invoke(method, argCount))
+            ObjString *method = READ_STRING();
+            int argCount = READ_BYTE();
+            auto &cache = frame->invoke_caches_[READ_SHORT()];
+            SAVE_FRAME();
+            if (!invoke(method, argCount, cache))
             {
                 return INTERPRET_RUNTIME_ERROR;
             }
-            frame = &current_coroutine_->frames_[current_coroutine_->frame_count_ - 1];
-            break;
+            LOAD_FRAME();
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_INHERIT:
+        CASE(OP_INHERIT)
         {
             if (!peek(1).is_obj_type<ObjClass>())
             {
+                SAVE_FRAME();
                 runtime_error("Superclass must be a class.");
                 return INTERPRET_RUNTIME_ERROR;
             }
             ObjClass *superclass = peek(1).as_obj<ObjClass>();
             ObjClass *subclass = peek(0).as_obj<ObjClass>();
-            for (const auto &[k, v] : superclass->methods_)
+            subclass->methods_.add_all(superclass->methods_);
+            subclass->touch();
+            for (auto &[name, method] : superclass->methods_)
             {
-                subclass->methods_.insert_or_assign(k, v);
+                gc_.write_barrier(subclass, name);
+                gc_.write_barrier(subclass, method);
             }
             pop();
-            break;
+            DISPATCH();
         }
-        case OP_GET_SUPER:
+        CASE(OP_GET_SUPER)
         {
-            ObjString *name = frame->read_string();
+            ObjString *name = READ_STRING();
             ObjClass *superclass = pop().as_obj<ObjClass>();
 
+            SAVE_FRAME();
             if (!bind_method(superclass, name))
                 return INTERPRET_RUNTIME_ERROR;
-            break;
+            DISPATCH();
         }
-        case OP_SUPER_INVOKE:
+        CASE(OP_SUPER_INVOKE)
         {
-            ObjString *method = frame->read_string();
-            int argCount = frame->read_byte();
+            ObjString *method = READ_STRING();
+            int argCount = READ_BYTE();
+            auto &cache = frame->invoke_caches_[READ_SHORT()];
             ObjClass *superclass = pop().as_obj<ObjClass>();
-            if (!invoke_from_class(superclass, method, argCount))
+            SAVE_FRAME();
+            if (auto cached = cache.find(0, superclass->stamp_))
+            {
+                if (!call(cached, argCount))
+                    return INTERPRET_RUNTIME_ERROR;
+            }
+            else if (!invoke_from_class(superclass, method, argCount, cache))
             {
                 return INTERPRET_RUNTIME_ERROR;
             }
-            frame = &current_coroutine_->frames_[current_coroutine_->frame_count_ - 1];
-            break;
+            LOAD_FRAME();
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_ARRAY:
+        CASE(OP_ARRAY)
         {
-            int count = frame->read_byte();
+            int count = READ_BYTE();
             auto objArray = create_obj<ObjArray>(this->gc_, count);
             for (int i = 0; i < count; i++)
                 objArray->values_.at(count - 1 - i) = pop();
             push(objArray);
-            break;
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_GET_ELEMENT:
+        CASE(OP_GET_ELEMENT)
         {
             if (peek(1).as<Obj *>()->is_type(objtype_of<ObjArray>()))
             {
+                if (peek(0).is_number())
+                    QUICKEN(OP_GET_ELEMENT_ARRAY);
                 auto index = pop().as<int>();
                 auto value = pop().as_obj<ObjArray>()->values_.at(index);
                 push(value);
             }
             else
-            { // json
+            {
                 auto key = pop();
                 auto value = pop().as_obj<ObjJson>()->kv_[key];
                 push(value);
             }
-            break;
+            DISPATCH();
+        }
+        CASE(OP_GET_ELEMENT_ARRAY)
+        {
+            Value &target = current_coroutine_->stack_[current_coroutine_->top_ - 2];
+            const Value &index = current_coroutine_->stack_[current_coroutine_->top_ - 1];
+            if (!target.is_obj() || !target.as<Obj *>()->is_type(objtype_of<ObjArray>()) || !index.is_number())
+                DEQUICKEN(OP_GET_ELEMENT);
+            auto &values = static_cast<ObjArray *>(target.as<Obj *>())->values_;
+            auto i = index.as<int>();
+            if (i < 0 || static_cast<size_t>(i) >= values.size())
+                DEQUICKEN(OP_GET_ELEMENT); // out of range: let the generic opcode fail the same way
+            target = values[i];
+            current_coroutine_->top_--;
+            DISPATCH();
         }
-        case OP_SET_ELEMENT:
+        CASE(OP_SET_ELEMENT)
         {
             if (peek(2).as<Obj *>()->is_type(objtype_of<ObjArray>()))
             {
@@ -586,105 +1040,125 @@ InterpretResult VM::run(ObjCoroutine *co)
                 auto array = pop().as_obj<ObjArray>();
                 int n = array->values_.size();
                 if (index >= n)
+                {
+                    SAVE_FRAME();
                     runtime_error("Index is larger than array size.");
+                }
                 array->values_.at(index) = value;
+                gc_.write_barrier(array, value);
                 push(value);
             }
             else
             {
                 auto value = pop();
                 auto key = pop();
-                pop().as_obj<ObjJson>()->kv_.insert_or_assign(key, value);
+                auto json = pop().as_obj<ObjJson>();
+                json->kv_.insert_or_assign(key, value);
+                gc_.write_barrier(json, key);
+                gc_.write_barrier(json, value);
                 push(value);
             }
-            break;
+            DISPATCH();
         }
-        case OP_JSON:
+        CASE(OP_JSON)
         {
-            int count = frame->read_byte();
+            int count = READ_BYTE();
             auto objJson = create_obj<ObjJson>(this->gc_);
             for (int i = 0; i < count; i++)
             {
                 auto value = pop();
                 auto key = pop();
                 objJson->kv_[key] = value;
+                gc_.write_barrier(objJson, key);
+                gc_.write_barrier(objJson, value);
             }
             push(objJson);
-            break;
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_CREATE_COROUTINE:
+        CASE(OP_CREATE_COROUTINE)
         {
             try
             {
                 std::vector<Value> arguments;
-                auto count = frame->read_byte();
+                auto count = READ_BYTE();
                 for (int i = 0; i < count; i++)
                     arguments.push_back(pop());
                 auto closure = pop().as_obj<ObjClosure>();
                 auto coroutine = create_obj<ObjCoroutine>(gc_, closure, arguments);
                 push(coroutine);
-                scheduler_.addObjCoroutine(coroutine);
             }
             catch (const std::exception &e)
             {
                 throw std::runtime_error("Only closure can be created as a coroutine.");
             }
-            break;
+            SAFEPOINT();
+            DISPATCH();
         }
-        case OP_YIELD_COROUTINE:
+        CASE(OP_YIELD_COROUTINE)
         {
+            SAVE_FRAME();
             scheduler_.yieldCurrentObjCoroutine();
-            return scheduler_.runNextObjCoroutine();
+            LOAD_FRAME();
+            DISPATCH();
         }
-        case OP_RESUME_COROUTINE:
+        CASE(OP_RESUME_COROUTINE)
         {
-            scheduler_.yieldCurrentObjCoroutine();
+            SAVE_FRAME();
+            ObjCoroutine *targetCo;
             try
             {
-                auto targetCo = pop().as_obj<ObjCoroutine>();
-                scheduler_.resumeCoroutine(targetCo);
+                targetCo = pop().as_obj<ObjCoroutine>();
             }
             catch (const std::exception &e)
             {
                 throw std::runtime_error("Only closure can be created as a coroutine.");
             }
-            break;
+            scheduler_.resumeCoroutine(targetCo); // a running or finished coroutine, or one waiting in resume, is left alone
+            LOAD_FRAME();
+            DISPATCH();
         }
+#include "superinstructions.inc"
+#ifndef USE_COMPUTED_GOTO
         default:
             std::cout << Opcode(instruction) << " error" << std::endl;
-            break;
+            DISPATCH();
+#endif
         }
+#ifndef USE_COMPUTED_GOTO
     }
-    return INTERPRET_OK;
-}
-
-uint8_t CallFrame::read_byte()
-{
-    return closure_->function_->chunk_.bytecode_[ip_++];
-}
-Value CallFrame::read_constant() { return closure_->function_->chunk_.constants_.at(read_byte()); }
-uint16_t CallFrame::read_short()
-{
-    ip_ += 2;
-    auto a = closure_->function_->chunk_.bytecode_[ip_ - 2] << 8;
-    auto b = closure_->function_->chunk_.bytecode_[ip_ - 1];
-    return static_cast<uint16_t>(a | b);
-};
-
-ObjString *CallFrame::read_string()
-{
-    return read_constant().as_obj<ObjString>();
+#endif
 }
+#ifdef USE_COMPUTED_GOTO
+#pragma GCC diagnostic pop
+#endif
 
 void VM::reset_stack()
 {
     current_coroutine_->top_ = current_coroutine_->frame_count_ = 0;
-    open_upvalues_ = nullptr;
+    current_coroutine_->open_upvalues_ = nullptr;
 }
 
 void VM::push(Value value)
 {
-    current_coroutine_->stack_.at(current_coroutine_->top_++) = value;
+    if (static_cast<size_t>(current_coroutine_->top_) == current_coroutine_->stack_.size())
+        current_coroutine_->grow_stack();
+    current_coroutine_->stack_[current_coroutine_->top_++] = value;
+}
+
+// left + right for OP_ADD when they are not both numbers: the text of both, as a new string; false when
+// one of them has no text
+bool VM::concatenate(const Value &left, const Value &right, Value &result)
+{
+    try
+    {
+        result = Value(create_obj_string(Value::value_to_string(left) + Value::value_to_string(right), *this));
+        return true;
+    }
+    catch (...)
+    {
+        return false;
+    }
 }
 
 Value VM::pop()
@@ -699,13 +1173,15 @@ Value VM::peek(int distance)
 
 void VM::close_upvalues(Value *last)
 {
-    while (open_upvalues_ != NULL &&
-           open_upvalues_->location_ >= last)
+    auto &open = current_coroutine_->open_upvalues_;
+    while (open != NULL &&
+           open->location_ >= last)
     {
-        ObjUpvalue *upvalue = open_upvalues_;
+        ObjUpvalue *upvalue = open;
         upvalue->closed_ = *upvalue->location_;
         upvalue->location_ = &upvalue->closed_;
-        open_upvalues_ = upvalue->next_;
+        gc_.write_barrier(upvalue, upvalue->closed_);
+        open = upvalue->next_;
     }
 }
 
@@ -713,26 +1189,25 @@ void VM::define_method(ObjString *name)
 {
     const Value &method = peek(0);
     ObjClass *klass = peek(1).as_obj<ObjClass>();
-    klass->methods_.insert_or_assign(name, method);
+    klass->methods_.set(name, method);
+    klass->touch();
+    gc_.write_barrier(klass, name);
+    gc_.write_barrier(klass, method);
     pop();
 }
 
 bool VM::bind_method(ObjClass *klass, ObjString *name)
 {
-    try
-    {
-        auto method = klass->methods_.at(name);
-        auto bound = create_obj<ObjBoundMethod>(gc_, peek(0), method.as_obj<ObjClosure>());
-        pop();
-        push(bound);
-        return true;
-    }
-    catch (const std::out_of_range &)
+    Value method;
+    if (!klass->methods_.get(name, method))
     {
         runtime_error("Undefined property ", *name, " .");
         return false;
     }
-    return false;
+    auto bound = create_obj<ObjBoundMethod>(gc_, peek(0), method.as_obj<ObjClosure>());
+    pop();
+    push(bound);
+    return true;
 }
 
 template <typename Operator>
@@ -765,7 +1240,7 @@ void VM::runtime_error(Args &&...args)
     {
         const auto &frame = current_coroutine_->frames_.at(i);
         auto function = frame.closure_->function_;
-        auto instruction = frame.ip_ - 1;
+        auto instruction = frame.ip_ - function->chunk_.bytecode_.data() - 1;
         auto line = function->chunk_.lines_.at(instruction);
         std::cerr << "[line " << line << "] in ";
         if (function->name_ == nullptr)
@@ -0,0 +1,425 @@
+#include "workers.hpp"
+#include "object.hpp"
+#include "objstring.hpp"
+#include "optimizer.hpp"
+#include "vm.hpp"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+static thread_local bool on_worker = false; // this thread belongs to the pool
+
+// copies values out of the heap of the VM on this thread; throws std::runtime_error on one that cannot leave it
+struct Exporter
+{
+	std::unordered_set<Obj *> open_; // arrays and jsons being copied, to catch cycles
+	std::unordered_map<ObjFunction *, std::shared_ptr<const Portable::Function>> functions_;
+
+	Portable value(const Value &value)
+	{
+		try
+		{
+			return copy(value);
+		}
+		catch (const std::runtime_error &)
+		{
+			open_.clear();
+			throw;
+		}
+	}
+
+private:
+	Portable copy(const Value &value)
+	{
+		Portable result;
+		if (value.is_undefined())
+			result.kind_ = Portable::Kind::Undefined;
+		else if (value.is_nil())
+			result.kind_ = Portable::Kind::Nil;
+		else if (value.is_bool())
+		{
+			result.kind_ = Portable::Kind::Bool;
+			result.boolean_ = value.as<bool>();
+		}
+		else if (value.is_number())
+		{
+			result.kind_ = Portable::Kind::Number;
+			result.number_ = value.as<int>();
+		}
+		else
+			copy(value.as<Obj *>(), result);
+		return result;
+	}
+
+	void copy(Obj *obj, Portable &result)
+	{
+		switch (obj->type_)
+		{
+		case ObjType::String:
+			result.kind_ = Portable::Kind::String;
+			result.text_ = static_cast<ObjString *>(obj)->text();
+			return;
+		case ObjType::Array:
+		case ObjType::Json:
+		{
+			if (!open_.insert(obj).second)
+				throw std::runtime_error("Cannot send this " + std::string(nameof(obj->type_)) + " to a worker: it contains itself.");
+			if (obj->type_ == ObjType::Array)
+			{
+				result.kind_ = Portable::Kind::Array;
+				for (auto &item : static_cast<ObjArray *>(obj)->values_)
+					result.items_.push_back(copy(item));
+			}
+			else
+			{
+				result.kind_ = Portable::Kind::Json;
+				for (auto &[key, item] : static_cast<ObjJson *>(obj)->kv_)
+				{
+					result.items_.push_back(copy(key));
+					result.items_.push_back(copy(item));
+				}
+			}
+			open_.erase(obj);
+			return;
+		}
+		case ObjType::Closure:
+		{
+			auto closure = static_cast<ObjClosure *>(obj);
+			if (closure->upvalue_count() > 0)
+				throw std::runtime_error("Cannot send a closure that captures variables to a worker.");
+			result.kind_ = Portable::Kind::Closure;
+			result.function_ = function(closure->function_);
+			return;
+		}
+		case ObjType::Function:
+			result.kind_ = Portable::Kind::Function;
+			result.function_ = function(static_cast<ObjFunction *>(obj));
+			return;
+		case ObjType::Native:
+			result.kind_ = Portable::Kind::Native;
+			result.text_ = static_cast<ObjNative *>(obj)->name_;
+			return;
+		default:
+			throw std::runtime_error("Cannot send this " + std::string(nameof(obj->type_)) + " to a worker.");
+		}
+	}
+
+	std::shared_ptr<const Portable::Function> function(ObjFunction *function)
+	{
+		if (auto found = functions_.find(function); found != functions_.end())
+			return found->second;
+		auto result = std::make_shared<Portable::Function>();
+		if (function->name_ != nullptr)
+			result->name_ = function->name_->text();
+		result->arity_ = function->arity_;
+		result->upvalue_count_ = function->upvalue_count_;
+		auto &chunk = function->chunk_;
+		result->bytecode_.assign(chunk.bytecode_.begin(), chunk.bytecode_.end());
+		result->lines_.assign(chunk.lines_.begin(), chunk.lines_.end());
+		for (auto &constant : chunk.constants_)
+			result->constants_.push_back(copy(constant));
+		result->caches_ = chunk.caches_.size();
+		result->invoke_caches_ = chunk.invoke_caches_.size();
+		functions_.emplace(function, result);
+		return result;
+	}
+};
+
+// rebuilds exported values in the heap of vm; nothing it allocates can be collected before the next safepoint
+struct Importer
+{
+	VM &vm_;
+	std::unordered_map<const Portable::Function *, ObjFunction *> functions_;
+
+	explicit Importer(VM &vm) : vm_(vm) {}
+
+	Value value(const Portable &value)
+	{
+		auto &gc = vm_.gc_;
+		switch (value.kind_)
+		{
+		case Portable::Kind::Undefined:
+			return Value::undefined();
+		case Portable::Kind::Nil:
+			return Value();
+		case Portable::Kind::Bool:
+			return Value(value.boolean_);
+		case Portable::Kind::Number:
+			return Value(value.number_);
+		case Portable::Kind::String:
+			return create_obj_string(std::string(value.text_), vm_);
+		case Portable::Kind::Array:
+		{
+			auto array = create_obj<ObjArray>(gc, 0);
+			for (auto &item : value.items_)
+			{
+				array->values_.push_back(this->value(item));
+				gc.write_barrier(array, array->values_.back());
+			}
+			return array;
+		}
+		case Portable::Kind::Json:
+		{
+			auto json = create_obj<ObjJson>(gc);
+			for (size_t i = 0; i + 1 < value.items_.size(); i += 2)
+			{
+				auto key = this->value(value.items_[i]);
+				auto item = this->value(value.items_[i + 1]);
+				json->kv_[key] = item;
+				gc.write_barrier(json, key);
+				gc.write_barrier(json, item);
+			}
+			return json;
+		}
+		case Portable::Kind::Function:
+			return function(*value.function_);
+		case Portable::Kind::Closure:
+			return create_obj<ObjClosure>(gc, function(*value.function_));
+		case Portable::Kind::Native:
+		{
+			// every VM defines the same natives when it starts
+			Value slot;
+			if (!vm_.globals_.get(create_obj_string(std::string(value.text_), vm_), slot))
+				return Value::undefined();
+			return vm_.global_values_[slot.as<int>()];
+		}
+		}
+		return Value();
+	}
+
+	// the bytecode refers to globals by the slots of the VM it was compiled in; natives come first in every VM,
+	// so declaring the rest in the same order gives them the same slots here
+	void globals(const std::vector<std::pair<std::string, Portable>> &globals)
+	{
+		for (size_t index = 0; index < globals.size(); index++)
+		{
+			auto &[name, global] = globals[index];
+			auto slot = vm_.global_slot(create_obj_string(std::string(name), vm_));
+			if (slot != index)
+				throw std::logic_error("Global " + name + " has another slot on the worker.");
+			if (vm_.global_values_[slot].is_undefined()) // the worker keeps its own natives
+				vm_.global_values_[slot] = value(global);
+		}
+	}
+
+private:
+	ObjFunction *function(const Portable::Function &from)
+	{
+		if (auto found = functions_.find(&from); found != functions_.end())
+			return found->second;
+		auto function = create_obj<ObjFunction>(vm_.gc_);
+		functions_.emplace(&from, function);
+		if (!from.name_.empty())
+			function->name_ = create_obj_string(std::string(from.name_), vm_);
+		function->arity_ = from.arity_;
+		function->upvalue_count_ = from.upvalue_count_;
+		auto &chunk = function->chunk_;
+		chunk.bytecode_.assign(from.bytecode_.begin(), from.bytecode_.end());
+		chunk.lines_.assign(from.lines_.begin(), from.lines_.end());
+		for (auto &constant : from.constants_)
+		{
+			chunk.constants_.push_back(value(constant));
+			vm_.gc_.write_barrier(function, chunk.constants_.back());
+		}
+		chunk.caches_.resize(from.caches_);
+		chunk.invoke_caches_.resize(from.invoke_caches_);
+		return function;
+	}
+};
+
+// the global slots the code of function reads, assigns or defines
+static std::vector<size_t> global_slots(ObjFunction *function)
+{
+	std::vector<size_t> slots;
+	auto &chunk = function->chunk_;
+	for (int offset = 0; offset < static_cast<int>(chunk.bytecode_.size()); offset += instruction_length(chunk, offset))
+	{
+		auto op = first_component(static_cast<Opcode>(chunk.bytecode_[offset]));
+		if (op == OP_GET_GLOBAL || op == OP_SET_GLOBAL || op == OP_DEFINE_GLOBAL)
+			slots.push_back((chunk.bytecode_[offset + 1] << 8) | chunk.bytecode_[offset + 2]);
+	}
+	return slots;
+}
+
+// runs task in a fresh VM on this thread: a runtime error is reported on stderr and fails the task
+static void run(WorkerTask &task)
+{
+	Portable result;
+	bool failed = true;
+	{
+		VM vm;
+		vm.gc_.fast_exit_ = false; // LOX_FAST_EXIT is for the main VM: this thread goes on to run more tasks
+		try
+		{
+			Importer import(vm);
+			import.globals(task.globals_);
+			auto closure = import.value(task.closure_).as_obj<ObjClosure>();
+			std::vector<Value> arguments;
+			for (auto &argument : task.arguments_)
+				arguments.push_back(import.value(argument));
+			auto co = create_obj<ObjCoroutine>(vm.gc_, closure, arguments);
+			co->is_main_ = true;
+			if (vm.scheduler_.start(co) == INTERPRET_OK)
+			{
+				result = Exporter().value(vm.result_);
+				failed = false;
+			}
+		}
+		catch (const std::exception &e)
+		{
+			std::cerr << e.what() << std::endl;
+		}
+	}
+#ifdef SLAB_ALLOC
+	slab::release_empty_pages(); // the size classes outlive the VM: keep only their current pages for the next task
+#endif
+#ifdef __GLIBC__
+	malloc_trim(0); // the freed pages otherwise stay in this thread's malloc arena while the worker waits
+#endif
+	std::lock_guard lock(task.mutex_);
+	task.result_ = std::move(result);
+	task.failed_ = failed;
+	task.finished_ = true;
+	task.done_.notify_all();
+}
+
+WorkerPool &WorkerPool::instance()
+{
+	static WorkerPool pool(size_ > 0 ? size_ : std::max(1u, std::thread::hardware_concurrency()));
+	return pool;
+}
+
+WorkerPool::WorkerPool(size_t count)
+	: deques_(count)
+{
+	for (size_t i = 0; i < count; i++)
+		threads_.emplace_back(&WorkerPool::work, this, i);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard lock(mutex_);
+		stopping_ = true;
+	}
+	wake_.notify_all();
+	for (auto &thread : threads_)
+		thread.join();
+}
+
+void WorkerPool::submit(std::shared_ptr<WorkerTask> task)
+{
+	auto &deque = deques_[next_++ % deques_.size()];
+	{
+		std::lock_guard lock(mutex_);
+		std::lock_guard deque_lock(deque.mutex_);
+		deque.tasks_.push_back(std::move(task));
+		pending_++;
+	}
+	wake_.notify_one();
+}
+
+std::shared_ptr<WorkerTask> WorkerPool::take(size_t self)
+{
+	std::shared_ptr<WorkerTask> task;
+	for (size_t i = 0; i < deques_.size() && task == nullptr; i++) // own deque first, then the next ones round
+	{
+		auto &deque = deques_[(self + i) % deques_.size()];
+		std::lock_guard lock(deque.mutex_);
+		if (deque.tasks_.empty())
+			continue;
+		task = std::move(deque.tasks_.front()); // oldest first: tasks are joined in the order they were submitted
+		deque.tasks_.pop_front();
+	}
+	if (task != nullptr)
+	{
+		std::lock_guard lock(mutex_); // submit counts a task only once it is in a deque, under this lock
+		pending_--;
+	}
+	return task;
+}
+
+void WorkerPool::work(size_t self)
+{
+	on_worker = true;
+	GC::trace_ = false;
+	for (;;)
+	{
+		{
+			std::unique_lock lock(mutex_);
+			wake_.wait(lock, [this] { return pending_ > 0 || stopping_; });
+			if (stopping_)
+				break;
+		}
+		if (auto task = take(self))
+			run(*task);
+	}
+#ifdef SLAB_ALLOC
+	slab::release_thread_pages();
+#endif
+}
+
+void submit_coroutine(VM &vm, ObjCoroutine *co)
+{
+	if (on_worker)
+		throw std::runtime_error("Only the main thread can submit coroutines.");
+	if (co->task_ != nullptr || co->status_ != CoroutineStatus::SUSPENDED || co->ready_ || co->frame_count_ != 1 ||
+		co->frames_[0].ip_ != co->closure_->function_->chunk_.bytecode_.data())
+		throw std::runtime_error("Only a coroutine that has not started can be submitted.");
+
+	auto task = std::make_shared<WorkerTask>();
+	Exporter exporter;
+	task->closure_ = exporter.value(co->closure_);
+	for (auto &argument : co->arguments_)
+		task->arguments_.push_back(exporter.value(argument));
+	Portable undefined;
+	undefined.kind_ = Portable::Kind::Undefined;
+	for (size_t slot = 0; slot < vm.global_values_.size(); slot++)
+		task->globals_.emplace_back(std::string(vm.global_names_[slot]->text()), undefined);
+	// only the globals the exported code names go over; the functions among their values name more in turn
+	std::vector<bool> named(vm.global_values_.size());
+	std::unordered_set<ObjFunction *> scanned;
+	for (std::vector<ObjFunction *> pending;; pending.clear())
+	{
+		for (auto &[function, _] : exporter.functions_)
+			if (scanned.insert(function).second)
+				pending.push_back(function);
+		if (pending.empty())
+			break;
+		for (auto function : pending)
+			for (auto slot : global_slots(function))
+			{
+				if (slot >= named.size() || named[slot])
+					continue;
+				named[slot] = true;
+				try
+				{
+					task->globals_[slot].second = exporter.value(vm.global_values_[slot]);
+				}
+				catch (const std::runtime_error &)
+				{
+				}
+			}
+	}
+
+	co->status_ = CoroutineStatus::FINISHED; // resume and spawn leave it alone from now on
+	co->task_ = task;
+	WorkerPool::instance().submit(std::move(task));
+}
+
+Value join_coroutine(VM &vm, ObjCoroutine *co)
+{
+	auto task = co->task_;
+	if (task == nullptr)
+		throw std::runtime_error("Only a submitted coroutine can be joined.");
+	std::unique_lock lock(task->mutex_);
+	task->done_.wait(lock, [&] { return task->finished_; });
+	if (task->failed_)
+		return Value();
+	return Importer(vm).value(task->result_);
+}
@@ -0,0 +1,386 @@
+// superinst: runs Lox scripts with an opcode profile (PROFILE_OPCODES), picks the runs of opcodes that
+// execute back to back most often, and writes them out as superinstructions:
+//   include/superinstructions.hpp  SUPERINSTRUCTION_NAMES for OPCODE_NAMES, SUPERINSTRUCTIONS for the
+//                                  optimizer and the disassembler
+//   src/superinstructions.inc      their handlers, included into VM::run
+// usage: superinst [--count=N] [--min-share=F] --out=<source dir> script.lox...
+//   a run is only chosen when it executes at least F times the opcode pairs of all scripts (default 0.001)
+#include "vm.hpp"
+#include "opcode.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	enum class Kind
+	{
+		Push,   // pushes `value`, computed from its operand
+		Unary,  // pops a, pushes `value`
+		Binary, // pops a and b (b on top), pushes `value`
+		Pop,
+		Store, // writes the top of the stack to the local in its operand
+		Jump,  // only last in a run
+		Loop,
+		JumpIfFalse,
+	};
+
+	struct Component
+	{
+		Opcode op;
+		Kind kind;
+		const char *value = nullptr; // $0: the operand byte, $a/$b: the popped values
+		bool numeric = false;		 // $a and $b must be numbers, otherwise the generic handlers take over
+		bool number = false;		 // value is an int
+	};
+
+	// what a superinstruction can be made of: instructions whose effect is on the stack and the frame's
+	// locals, and which can be checked for the slow path before any of them has run
+	const Component COMPONENTS[] = {
+		{OP_CONSTANT, Kind::Push, "frame->constants_[$0]"},
+		{OP_GET_LOCAL, Kind::Push, "frame->slots_[$0]"},
+		{OP_NIL, Kind::Push, "Value()"},
+		{OP_TRUE, Kind::Push, "Value(true)"},
+		{OP_FALSE, Kind::Push, "Value(false)"},
+		{OP_SET_LOCAL, Kind::Store},
+		{OP_POP, Kind::Pop},
+		{OP_NEGATE, Kind::Unary, "-$a.as<int>()", true, true},
+		{OP_NOT, Kind::Unary, "is_falsey($a)"},
+		{OP_ADD, Kind::Binary, "$a.as<int>() + $b.as<int>()", true, true},
+		{OP_SUB, Kind::Binary, "$a.as<int>() - $b.as<int>()", true, true},
+		{OP_MUL, Kind::Binary, "$a.as<int>() * $b.as<int>()", true, true},
+		{OP_LESS, Kind::Binary, "$a.as<int>() < $b.as<int>()", true},
+		{OP_GREATER, Kind::Binary, "$a.as<int>() > $b.as<int>()", true},
+		{OP_LESS_EQUAL, Kind::Binary, "$a.as<int>() <= $b.as<int>()", true},
+		{OP_GREATER_EQUAL, Kind::Binary, "$a.as<int>() >= $b.as<int>()", true},
+		{OP_EQUAL, Kind::Binary, "$a == $b"},
+		{OP_NOT_EQUAL, Kind::Binary, "!($a == $b)"},
+		{OP_JUMP, Kind::Jump},
+		{OP_LOOP, Kind::Loop},
+		{OP_JUMP_IF_FALSE, Kind::JumpIfFalse},
+	};
+
+	const Component *component(Opcode op)
+	{
+		for (auto &c : COMPONENTS)
+			if (c.op == op)
+				return &c;
+		return nullptr;
+	}
+
+	int operand_bytes(const Component &c)
+	{
+		switch (c.kind)
+		{
+		case Kind::Push: // OP_NIL, OP_TRUE and OP_FALSE have none
+			return std::string_view(c.value).find("$0") != std::string_view::npos ? 1 : 0;
+		case Kind::Store:
+			return 1;
+		case Kind::Jump:
+		case Kind::Loop:
+		case Kind::JumpIfFalse:
+			return 2;
+		default:
+			return 0;
+		}
+	}
+
+	std::string name_of(Opcode op)
+	{
+		std::ostringstream os;
+		os << op;
+		return os.str();
+	}
+
+	std::string replace_all(std::string text, std::string_view from, const std::string &to)
+	{
+		for (auto at = text.find(from); at != std::string::npos; at = text.find(from, at + to.size()))
+			text.replace(at, from.size(), to);
+		return text;
+	}
+
+	// the handler body for a run, or nothing when the run cannot be fused: every value is read into a
+	// temporary and checked before the run's stores and stack changes, so a failed check can hand the
+	// untouched instruction to the first component's handler
+	std::optional<std::string> generate_handler(const std::vector<Opcode> &run)
+	{
+		struct Entry
+		{
+			std::string name;
+			bool number = false; // known to be an int, so needs no check
+		};
+		std::vector<Entry> stack;
+		std::vector<int> uses;
+		std::ostringstream reads, stores;
+		int borrowed = 0; // values taken from below the run's own pushes
+		bool stored = false;
+		int at = 0;		  // where the current component starts; ip[at] is its first operand once the first opcode is read
+		auto first = name_of(run.front());
+
+		auto temporary = [&](const std::string &value, bool number)
+		{
+			auto name = "v" + std::to_string(uses.size());
+			uses.push_back(0);
+			reads << "            Value " << name << " = " << value << ";\n";
+			stack.push_back({name, number});
+		};
+		auto take = [&](bool read) -> std::optional<Entry>
+		{
+			if (stack.empty())
+			{
+				if (!read)
+				{
+					borrowed++;
+					return Entry{};
+				}
+				if (stored) // the value may sit in a slot the run has just written
+					return std::nullopt;
+				temporary("peek(" + std::to_string(borrowed++) + ")", false);
+			}
+			auto entry = stack.back();
+			stack.pop_back();
+			if (read)
+				uses[std::stoi(entry.name.substr(1))]++;
+			return entry;
+		};
+		auto top = [&]() -> std::optional<Entry>
+		{
+			auto entry = take(true); // taken and put back, so a borrowed value is popped and pushed again
+			if (entry)
+				stack.push_back(*entry);
+			return entry;
+		};
+
+		std::string jump;
+		for (size_t i = 0; i < run.size(); i++)
+		{
+			auto c = component(run[i]);
+			bool last = i + 1 == run.size();
+			if (c == nullptr)
+				return std::nullopt;
+			auto operand = "ip[" + std::to_string(at) + "]";
+			switch (c->kind)
+			{
+			case Kind::Push:
+				if (c->op == OP_GET_LOCAL && stored)
+					return std::nullopt;
+				temporary(replace_all(c->value, "$0", operand), false);
+				break;
+			case Kind::Store:
+			{
+				auto value = top();
+				if (!value)
+					return std::nullopt;
+				stores << "            frame->slots_[" << operand << "] = " << value->name << ";\n";
+				stored = true;
+				break;
+			}
+			case Kind::Pop:
+				take(false);
+				break;
+			case Kind::Unary:
+			case Kind::Binary:
+			{
+				auto b = take(true);
+				auto a = c->kind == Kind::Binary ? take(true) : b;
+				if (!a || !b)
+					return std::nullopt;
+				std::string checks;
+				for (auto &operand : c->kind == Kind::Binary ? std::vector{*a, *b} : std::vector{*a})
+					if (c->numeric && !operand.number)
+						checks += (checks.empty() ? "!" : " || !") + operand.name + ".is_number()";
+				if (!checks.empty())
+					reads << "            if (" << checks << ")\n                REDISPATCH(" << first << ");\n";
+				temporary(replace_all(replace_all(c->value, "$a", a->name), "$b", b->name), c->number);
+				break;
+			}
+			case Kind::Jump:
+			case Kind::Loop:
+			case Kind::JumpIfFalse:
+			{
+				if (!last)
+					return std::nullopt;
+				reads << "            int offset = (" << operand << " << 8) | ip[" << at + 1 << "];\n";
+				if (c->kind == Kind::Jump)
+					jump = "            ip += offset;\n";
+				else if (c->kind == Kind::Loop)
+					jump = "            ip -= offset;\n            SAFEPOINT();\n";
+				else
+				{
+					auto condition = top();
+					if (!condition)
+						return std::nullopt;
+					jump = "            if (is_falsey(" + condition->name + "))\n                ip += offset;\n";
+				}
+				break;
+			}
+			}
+			at += 1 + operand_bytes(*c);
+		}
+
+		for (auto &entry : stack) // what the run leaves on the stack
+			uses[std::stoi(entry.name.substr(1))]++;
+		if (std::count(uses.begin(), uses.end(), 0) != 0)
+			return std::nullopt; // computes something only to pop it; the optimizer drops most of these anyway
+
+		std::ostringstream handler;
+		handler << reads.str() << stores.str();
+		if (borrowed != 0)
+			handler << "            current_coroutine_->top_ -= " << borrowed << ";\n";
+		for (auto &entry : stack)
+			handler << "            push(" << entry.name << ");\n";
+		handler << "            ip += " << at - 1 << ";\n"
+				<< jump;
+		return handler.str();
+	}
+
+	struct Candidate
+	{
+		std::vector<Opcode> run;
+		uint64_t count;
+		std::string handler;
+		uint64_t saved() const { return count * (run.size() - 1); } // dispatches a fused run saves
+	};
+
+	std::string superinstruction_name(const std::vector<Opcode> &run)
+	{
+		std::string name = "OP_SUPER";
+		for (auto op : run)
+			name += name_of(op).substr(2); // drop "OP"
+		return name;
+	}
+
+	bool contains(const std::vector<Opcode> &outer, const std::vector<Opcode> &inner)
+	{
+		return std::search(outer.begin(), outer.end(), inner.begin(), inner.end()) != outer.end();
+	}
+
+	std::string read_file(const std::string &path)
+	{
+		std::ifstream file(path, std::ios::in | std::ios::binary);
+		if (!file)
+			throw std::runtime_error("Could not open file: " + path);
+		std::ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t count = 10;
+	double min_share = 0.001;
+	std::string out;
+	std::vector<std::string> scripts;
+	for (int arg = 1; arg < argc; arg++)
+	{
+		std::string_view option = argv[arg];
+		if (option.substr(0, 8) == "--count=")
+			count = std::strtoul(argv[arg] + 8, nullptr, 10);
+		else if (option.substr(0, 12) == "--min-share=")
+			min_share = std::strtod(argv[arg] + 12, nullptr);
+		else if (option.substr(0, 6) == "--out=")
+			out = option.substr(6);
+		else
+			scripts.emplace_back(option);
+	}
+	if (out.empty() || scripts.empty())
+	{
+		std::cerr << "usage: superinst [--count=N] [--min-share=F] --out=<source dir> script.lox..." << std::endl;
+		return 1;
+	}
+
+	std::map<std::vector<Opcode>, uint64_t> runs;
+	uint64_t total = 0; // opcode pairs executed by all scripts
+	for (auto &script : scripts)
+	{
+		auto source = read_file(script);
+		std::ostringstream discarded;
+		auto cout = std::cout.rdbuf(discarded.rdbuf()), cerr = std::cerr.rdbuf(discarded.rdbuf());
+		InterpretResult result;
+		uint64_t executed = 0;
+		{
+			VM vm;
+			result = vm.interpret(source);
+			for (auto [key, n] : vm.profile_.runs_)
+			{
+				size_t length = 2;
+				while (length <= OpcodeProfile::MAX_LENGTH && (key >> (8 * length)) != length)
+					length++;
+				std::vector<Opcode> run(length);
+				for (size_t i = 0; i < length; i++)
+					run[i] = static_cast<Opcode>((key >> (8 * (length - 1 - i))) & 0xff);
+				runs[run] += n;
+				executed += length == 2 ? n : 0;
+			}
+		}
+		std::cout.rdbuf(cout);
+		std::cerr.rdbuf(cerr);
+		total += executed;
+		std::cout << script << ": " << executed << " opcode pairs" << (result == INTERPRET_OK ? "" : " (ended with an error)") << std::endl;
+	}
+
+	std::vector<Candidate> candidates;
+	for (auto &[run, n] : runs)
+	{
+		if (n < min_share * total)
+			continue; // too rare to be worth an opcode, even when --count leaves slots free
+		if (auto handler = generate_handler(run))
+			candidates.push_back({run, n, *handler});
+	}
+	std::stable_sort(candidates.begin(), candidates.end(), [](auto &a, auto &b)
+					 { return a.saved() > b.saved(); });
+
+	// a run inside one already chosen mostly executes as part of it, since the longest run wins; it is only
+	// worth its own opcode when it also runs often elsewhere. A longer run around a chosen one is fine
+	std::vector<Candidate> chosen;
+	for (auto &candidate : candidates)
+	{
+		if (chosen.size() == count)
+			break;
+		bool covered = std::any_of(chosen.begin(), chosen.end(), [&](auto &c)
+								   { return contains(c.run, candidate.run) && candidate.count < 2 * c.count; });
+		if (!covered)
+			chosen.push_back(candidate);
+	}
+
+	std::ofstream header(out + "/include/superinstructions.hpp"), handlers(out + "/src/superinstructions.inc");
+	if (!header || !handlers)
+	{
+		std::cerr << "Could not write to " << out << std::endl;
+		return 1;
+	}
+	header << "// generated by tools/superinst.cpp (cmake --build <dir> --target superinstructions), do not edit\n"
+		   << "#pragma once\n\n"
+		   << "#define SUPERINSTRUCTION_NAMES \\\n";
+	for (auto &c : chosen)
+		header << "    X(" << superinstruction_name(c.run) << ") \\\n";
+	header << "\n// S(superinstruction, components...)\n"
+		   << "#define SUPERINSTRUCTIONS \\\n";
+	for (auto &c : chosen)
+	{
+		header << "    S(" << superinstruction_name(c.run);
+		for (auto op : c.run)
+			header << ", " << name_of(op);
+		header << ") \\\n";
+	}
+	header << "\n";
+
+	handlers << "// generated by tools/superinst.cpp (cmake --build <dir> --target superinstructions), do not edit\n";
+	for (auto &c : chosen)
+	{
+		handlers << "        CASE(" << superinstruction_name(c.run) << ") // executed " << c.count << " times in the profile\n"
+				 << "        {\n"
+				 << c.handler
+				 << "            DISPATCH();\n"
+				 << "        }\n";
+		std::cout << superinstruction_name(c.run) << ": " << c.count << std::endl;
+	}
+	return 0;
+}